@@ -11,6 +11,7 @@
 #include "TextDecoderUtils.h"
 
 #include "hermes/Platform/Unicode/CharacterProperties.h"
+#include "hermes/Support/FastCharScan.h"
 #include "hermes/Support/UTF8.h"
 
 #include <cstdint>
@@ -185,29 +186,32 @@ jsi::Value textDecoderDecode(
         static_cast<uint8_t>(state->encoding) - kFirstSingleByteEncoding;
     const char16_t *table = kSingleByteEncodings.at(tableIndex);
 
-    // Single pass: decode and check if all ASCII simultaneously
-    std::u16string decoded;
-    decoded.reserve(length);
-    bool allAscii = true;
+    // All-ASCII input maps to itself and needs no conversion at all.
+    const uint8_t *end = bytes + length;
+    const uint8_t *asciiEnd = ::hermes::scanASCII(bytes, end);
+    if (asciiEnd == end) {
+      return jsi::String::createFromAscii(
+          rt, reinterpret_cast<const char *>(bytes), length);
+    }
 
-    for (size_t i = 0; i < length; ++i) {
-      uint8_t b = bytes[i];
+    // Widen the ASCII prefix, then map the rest through the table.
+    std::u16string decoded(length, u'\0');
+    char16_t *out = &decoded[0];
+    for (const uint8_t *p = bytes; p != asciiEnd; ++p) {
+      *out++ = static_cast<char16_t>(*p);
+    }
+    for (const uint8_t *p = asciiEnd; p != end; ++p) {
+      uint8_t b = *p;
       if (b < 0x80) {
-        decoded.push_back(static_cast<char16_t>(b));
+        *out++ = static_cast<char16_t>(b);
       } else {
-        allAscii = false;
         char16_t cp = table[b - 0x80];
         if (state->fatal && cp == UNICODE_REPLACEMENT_CHARACTER) {
           throwTypeError(rt, "Invalid byte sequence");
         }
-        decoded.push_back(cp);
+        *out++ = cp;
       }
     }
-
-    if (allAscii) {
-      return jsi::String::createFromAscii(
-          rt, reinterpret_cast<const char *>(bytes), length);
-    }
     return jsi::String::createFromUtf16(rt, decoded.data(), decoded.size());
   }
 
@@ -223,15 +227,8 @@ jsi::Value textDecoderDecode(
       asciiBytes += 3;
       asciiLength -= 3;
     }
-    // Check if all bytes are ASCII
-    bool allASCII = true;
-    for (size_t i = 0; i < asciiLength; ++i) {
-      if (asciiBytes[i] >= 0x80) {
-        allASCII = false;
-        break;
-      }
-    }
-    if (allASCII) {
+    if (::hermes::scanASCII(asciiBytes, asciiBytes + asciiLength) ==
+        asciiBytes + asciiLength) {
       // Update or reset streaming state
       if (stream) {
         if (asciiLength > 0 && !state->bomSeen) {
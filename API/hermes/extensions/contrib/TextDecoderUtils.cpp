@@ -8,6 +8,7 @@
 #include "TextDecoderUtils.h"
 
 #include "hermes/Platform/Unicode/CharacterProperties.h"
+#include "hermes/Support/FastCharScan.h"
 #include "hermes/Support/UTF8.h"
 #include "llvh/ADT/SmallVector.h"
 #include "llvh/Support/ConvertUTF.h"
@@ -439,7 +440,13 @@ DecodeError decodeUTF8(
     }
   }
 
-  decoded->reserve(processLength);
+  // Every input byte produces at most one UTF-16 code unit (a 4-byte sequence
+  // produces a surrogate pair, and each ill-formed subpart a single
+  // replacement character), plus one replacement character for an incomplete
+  // sequence at the end. Size the output for that and write it directly.
+  size_t outStart = decoded->size();
+  decoded->resize(outStart + processLength + 1);
+  char16_t *out = &(*decoded)[outStart];
 
   // Mark BOM as seen once we actually process bytes (not just buffer them).
   if (!*outBOMSeen && processLength > 0) {
@@ -450,23 +457,39 @@ DecodeError decodeUTF8(
   const llvh::UTF8 *srcEnd = bytes + processLength;
 
   while (src < srcEnd) {
-    llvh::UTF16 buf[256];
-    llvh::UTF16 *dst = buf;
-    llvh::ConversionResult res = llvh::ConvertUTF8toUTF16(
-        &src, srcEnd, &dst, buf + 256, llvh::lenientConversion);
+    // Widen the run of ASCII bytes, which is usually most of the input.
+    const uint8_t *asciiEnd = ::hermes::scanASCII(src, srcEnd);
+    for (; src != asciiEnd; ++src) {
+      *out++ = *src;
+    }
+    if (src == srcEnd) {
+      break;
+    }
 
-    decoded->append(
-        reinterpret_cast<char16_t *>(buf), reinterpret_cast<char16_t *>(dst));
+    // ASCII bytes are never part of a multi-byte sequence, so the following
+    // run of non-ASCII bytes can be converted on its own.
+    const uint8_t *runEnd = src;
+    while (runEnd != srcEnd && *runEnd >= 0x80) {
+      ++runEnd;
+    }
+    while (src < runEnd) {
+      llvh::UTF16 *dst = reinterpret_cast<llvh::UTF16 *>(out);
+      llvh::ConversionResult res = llvh::ConvertUTF8toUTF16(
+          &src, runEnd, &dst, dst + (runEnd - src), llvh::lenientConversion);
+      out = reinterpret_cast<char16_t *>(dst);
 
-    if (res == llvh::conversionOK) {
-      break;
-    } else if (res == llvh::sourceIllegal || res == llvh::sourceExhausted) {
+      if (res == llvh::conversionOK) {
+        break;
+      }
+      assert(
+          (res == llvh::sourceIllegal || res == llvh::sourceExhausted) &&
+          "output is sized for the whole input");
       if (fatal) {
         return DecodeError::InvalidSequence;
       }
       // Consume the maximal subpart of the ill-formed sequence.
-      decoded->push_back(UNICODE_REPLACEMENT_CHARACTER);
-      src += maximalSubpartLength(src, srcEnd - src);
+      *out++ = UNICODE_REPLACEMENT_CHARACTER;
+      src += maximalSubpartLength(src, runEnd - src);
     }
   }
 
@@ -481,9 +504,10 @@ DecodeError decodeUTF8(
     if (fatal) {
       return DecodeError::InvalidSequence;
     }
-    decoded->push_back(UNICODE_REPLACEMENT_CHARACTER);
+    *out++ = UNICODE_REPLACEMENT_CHARACTER;
   }
 
+  decoded->resize(out - decoded->data());
   return DecodeError::None;
 }
 
@@ -532,18 +556,26 @@ DecodeError decodeUTF16(
     }
   };
 
-  decoded->reserve((end - start) / 2 + 1);
+  // Every input code unit produces one output code unit, plus one
+  // replacement character for a trailing odd byte. Size the output for that
+  // and write it directly.
+  size_t outStart = decoded->size();
+  decoded->resize(outStart + (end - start) / 2 + 1);
+  char16_t *out = &(*decoded)[outStart];
 
   const uint8_t *p = start;
   while (p < end) {
     char16_t cu = readU16(p);
 
-    if (isHighSurrogate(cu)) {
+    if (LLVM_LIKELY(!isHighSurrogate(cu) && !isLowSurrogate(cu))) {
+      *out++ = cu;
+      p += 2;
+    } else if (isHighSurrogate(cu)) {
       if (p + 4 <= end) {
         char16_t next = readU16(p + 2);
         if (isLowSurrogate(next)) {
-          decoded->push_back(cu);
-          decoded->push_back(next);
+          *out++ = cu;
+          *out++ = next;
           p += 4;
           continue;
         }
@@ -562,7 +594,7 @@ DecodeError decodeUTF16(
         if (fatal) {
           return DecodeError::InvalidSurrogate;
         }
-        decoded->push_back(UNICODE_REPLACEMENT_CHARACTER);
+        *out++ = UNICODE_REPLACEMENT_CHARACTER;
         // Skip the high surrogate and consume the trailing odd byte together
         hasTrailingByte = false;
         p += 2;
@@ -571,16 +603,14 @@ DecodeError decodeUTF16(
       if (fatal) {
         return DecodeError::InvalidSurrogate;
       }
-      decoded->push_back(UNICODE_REPLACEMENT_CHARACTER);
+      *out++ = UNICODE_REPLACEMENT_CHARACTER;
       p += 2;
-    } else if (isLowSurrogate(cu)) {
+    } else {
+      // Lone low surrogate.
       if (fatal) {
         return DecodeError::InvalidSurrogate;
       }
-      decoded->push_back(UNICODE_REPLACEMENT_CHARACTER);
-      p += 2;
-    } else {
-      decoded->push_back(cu);
+      *out++ = UNICODE_REPLACEMENT_CHARACTER;
       p += 2;
     }
   }
@@ -592,10 +622,11 @@ DecodeError decodeUTF16(
       outPendingBytes[*outPendingCount] = bytes[length - 1];
       ++(*outPendingCount);
     } else {
-      decoded->push_back(UNICODE_REPLACEMENT_CHARACTER);
+      *out++ = UNICODE_REPLACEMENT_CHARACTER;
     }
   }
 
+  decoded->resize(out - decoded->data());
   return DecodeError::None;
 }
 
@@ -246,6 +246,7 @@ class HermesRootAPI final : public IHermesRootAPI, public ISetFatalHandler {
 namespace {
 class HermesRuntimeImpl final : public HermesRuntime,
                                 private IHermesTestHelpers,
+                                private IHermesTimeSlicing,
                                 private InstallHermesFatalErrorHandler,
                                 private jsi::Instrumentation
 #ifdef JSI_UNSTABLE
@@ -1252,6 +1253,12 @@ class HermesRuntimeImpl final : public HermesRuntime,
   void asyncTriggerTimeout() override;
   void watchTimeLimit(uint32_t timeoutInMs) override;
   void unwatchTimeLimit() override;
+
+  // IHermesTimeSlicing
+  void setYieldHandler(std::function<void()> handler) override;
+  void asyncRequestYield() override;
+  void watchTimeSlice(uint32_t sliceInMs) override;
+  void unwatchTimeSlice() override;
   jsi::Value evaluateJavaScriptWithSourceMap(
       const std::shared_ptr<const jsi::Buffer> &buffer,
       const std::shared_ptr<const jsi::Buffer> &sourceMapBuf,
@@ -1497,6 +1504,8 @@ jsi::ICast *HermesRuntimeImpl::getHermesRootAPI() {
 jsi::ICast *HermesRuntimeImpl::castInterface(const jsi::UUID &interfaceUUID) {
   if (interfaceUUID == IHermesTestHelpers::uuid) {
     return static_cast<IHermesTestHelpers *>(this);
+  } else if (interfaceUUID == IHermesTimeSlicing::uuid) {
+    return static_cast<IHermesTimeSlicing *>(this);
   } else if (interfaceUUID == IHermes::uuid) {
     return static_cast<IHermes *>(this);
   } else if (interfaceUUID == IHermesSHUnit::uuid) {
@@ -1774,6 +1783,56 @@ void HermesRuntimeImpl::unwatchTimeLimit() {
   }
 }
 
+void HermesRuntimeImpl::setYieldHandler(std::function<void()> handler) {
+  if (!handler) {
+    runtime_.setYieldCallback(nullptr);
+    return;
+  }
+  runtime_.setYieldCallback(
+      [this, handler = std::move(handler)]() -> vm::ExecutionStatus {
+        vm::Runtime &runtime = runtime_;
+        try {
+          handler();
+        }
+#ifdef HERMESVM_EXCEPTION_ON_OOM
+        catch (const vm::JSOutOfMemoryError &) {
+          throw;
+        }
+#endif
+        catch (const jsi::JSError &error) {
+          return runtime.setThrownValue(hvFromValue(error.value()));
+        } catch (const std::exception &ex) {
+          llvh::SmallVector<llvh::UTF16, 16> buf;
+          return runtime.raiseError(
+              vm::TwineChar16{"Exception in yield handler: "} +
+              utf16FromErrorWhat(ex, buf));
+        } catch (...) {
+          return runtime.raiseError("Exception in yield handler: <unknown>");
+        }
+        return vm::ExecutionStatus::RETURNED;
+      });
+}
+
+void HermesRuntimeImpl::asyncRequestYield() {
+  runtime_.triggerYieldAsyncBreak();
+}
+
+void HermesRuntimeImpl::watchTimeSlice(uint32_t sliceInMs) {
+  auto &runtimeTimeLimitMonitor = runtime_.timeLimitMonitor;
+  if (!runtimeTimeLimitMonitor) {
+    runtimeTimeLimitMonitor = ::hermes::vm::TimeLimitMonitor::getOrCreate();
+  }
+  runtimeTimeLimitMonitor->watchRuntimeTimeSlice(
+      runtime_, std::chrono::milliseconds(sliceInMs));
+}
+
+void HermesRuntimeImpl::unwatchTimeSlice() {
+  vm::Runtime &runtime = runtime_;
+  if (auto &runtimeTimeLimitMonitor = runtime.timeLimitMonitor) {
+    runtimeTimeLimitMonitor->unwatchRuntimeTimeSlice(runtime);
+  }
+}
+
 namespace {
 
 /// If the buffer contains an embedded terminating zero, shrink it, so it is
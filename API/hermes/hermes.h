@@ -8,6 +8,7 @@
 #pragma once
 
 #include <exception>
+#include <functional>
 #include <list>
 #include <map>
 #include <memory>
@@ -172,6 +173,44 @@ class HERMES_EXPORT IHermesTestHelpers : public jsi::ICast {
   ~IHermesTestHelpers() = default;
 };
 
+/// Interface for cooperatively time-slicing JS execution, so that a host can
+/// run other work, such as JS in other runtimes on the same thread, in the
+/// middle of a long-running script. Like the time limit methods of IHermes,
+/// this requires JS compiled with async break checks.
+class HERMES_EXPORT IHermesTimeSlicing : public jsi::ICast {
+ public:
+  static constexpr jsi::UUID uuid{
+      0x3d686b8a,
+      0xcb1e,
+      0x11f1,
+      0x9347,
+      0x02fc00000001};
+
+  /// Set the handler called when JS execution yields, replacing any previous
+  /// one. The handler runs on the thread executing JS, at the async break
+  /// check where execution was interrupted, and the script resumes exactly
+  /// where it left off when the handler returns. Execution of other runtimes
+  /// started from the handler must complete or yield back before it returns,
+  /// so paused scripts are resumed in LIFO order. A jsi::JSError thrown by
+  /// the handler is thrown in JS from the yield point, which can be used to
+  /// cancel the script. Yield requests are ignored while no handler is set.
+  virtual void setYieldHandler(std::function<void()> handler) = 0;
+
+  /// Asynchronously requests the current execution to yield to the yield
+  /// handler. This can be called on any thread.
+  virtual void asyncRequestYield() = 0;
+
+  /// Request execution to yield every \p sliceInMs milliseconds, which must
+  /// not be 0, until unwatchTimeSlice() is called. The slices are measured in
+  /// wall time starting from this call, which restarts the current slice.
+  virtual void watchTimeSlice(uint32_t sliceInMs) = 0;
+  /// Stop requesting execution to yield periodically.
+  virtual void unwatchTimeSlice() = 0;
+
+ protected:
+  ~IHermesTimeSlicing() = default;
+};
+
 #ifdef JSI_UNSTABLE
 // Interface for methods that are exposed for tracing purposes.
 class IHermesTracingHelpers : public jsi::ICast {
@@ -343,6 +343,28 @@ NodeApiReference *asReference(void *ref) noexcept;
 // Reinterpret cast to NodeApiHostFunctionContext::NodeApiCallbackInfo
 NodeApiCallbackInfo *asCallbackInfo(napi_callback_info callbackInfo) noexcept;
 
+// Convert Latin1 string to UTF-16.
+std::u16string latin1ToUtf16(const char *str, size_t length) noexcept;
+
+// Get the SymbolID for the UTF-8 encoded \p str. ASCII strings are looked up
+// in the identifier table directly without allocating a temporary string.
+vm::CallResult<vm::Handle<vm::SymbolID>>
+utf8ToSymbolID(vm::Runtime &runtime, const char *str, size_t length) noexcept;
+
+// Get the SymbolID for the Latin1 encoded \p str. ASCII strings are looked up
+// in the identifier table directly without allocating a temporary string.
+vm::CallResult<vm::Handle<vm::SymbolID>>
+latin1ToSymbolID(vm::Runtime &runtime, const char *str, size_t length) noexcept;
+
+// Wrap a Node-API finalizer for the external \p data into a context that
+// schedules the finalizer once the last reference to it is released.
+std::shared_ptr<void> makeExternalDataContext(
+    NodeApiEnvironment &env,
+    void *data,
+    size_t byteLength,
+    node_api_basic_finalize finalizeCallback,
+    void *finalizeHint) noexcept;
+
 // Copy ASCII input to UTF8 buffer. It is a convenience function to match the
 // convertUTF16ToUTF8WithReplacements signature when using std::copy.
 size_t copyASCIIToUTF8(
@@ -2385,7 +2407,7 @@ class NodeApiStringBuilder final {
 // The external buffer that implements hermes::Buffer
 // This class integrates with the Node-API finalizer infrastructure to ensure
 // user finalizers are called on the JS thread when the buffer is garbage
-// collected.
+// collected. It also keeps alive the characters of external strings.
 class NodeApiExternalBuffer final : public hermes::Buffer {
  public:
   NodeApiExternalBuffer(
@@ -4056,6 +4078,48 @@ std::u16string latin1ToUtf16(const char *str, size_t length) noexcept {
   return u16str;
 }
 
+vm::CallResult<vm::Handle<vm::SymbolID>>
+utf8ToSymbolID(vm::Runtime &runtime, const char *str, size_t length) noexcept {
+  if (::hermes::isAllASCII(str, str + length)) {
+    return runtime.getIdentifierTable().getSymbolHandle(
+        runtime, llvh::makeArrayRef(str, length));
+  }
+  vm::CallResult<vm::HermesValue> strRes = vm::StringPrimitive::createEfficient(
+      runtime,
+      llvh::makeArrayRef(reinterpret_cast<const uint8_t *>(str), length),
+      /*IgnoreInputErrors:*/ true);
+  if (strRes.getStatus() == vm::ExecutionStatus::EXCEPTION) {
+    return vm::ExecutionStatus::EXCEPTION;
+  }
+  return vm::stringToSymbolID(
+      runtime, vm::createPseudoHandle(strRes->getString()));
+}
+
+vm::CallResult<vm::Handle<vm::SymbolID>> latin1ToSymbolID(
+    vm::Runtime &runtime,
+    const char *str,
+    size_t length) noexcept {
+  if (::hermes::isAllASCII(str, str + length)) {
+    return runtime.getIdentifierTable().getSymbolHandle(
+        runtime, llvh::makeArrayRef(str, length));
+  }
+  std::u16string u16str = latin1ToUtf16(str, length);
+  return runtime.getIdentifierTable().getSymbolHandle(
+      runtime, llvh::makeArrayRef(u16str.data(), u16str.size()));
+}
+
+std::shared_ptr<void> makeExternalDataContext(
+    NodeApiEnvironment &env,
+    void *data,
+    size_t byteLength,
+    node_api_basic_finalize finalizeCallback,
+    void *finalizeHint) noexcept {
+  return std::shared_ptr<void>(
+      new NodeApiExternalBuffer(
+          env, data, byteLength, basicFinalize(finalizeCallback), finalizeHint),
+      [](void *ptr) { delete reinterpret_cast<NodeApiExternalBuffer *>(ptr); });
+}
+
 //-----------------------------------------------------------------------------
 // non Node-API external APIs
 //-----------------------------------------------------------------------------
@@ -4663,18 +4727,8 @@ napi_status NAPI_CDECL napi_set_named_property(
   vm::Handle<vm::JSObject> objHandle =
       env->runtime_.makeHandle<vm::JSObject>(*objRes);
 
-  vm::CallResult<vm::HermesValue> strRes = vm::StringPrimitive::createEfficient(
-      env->runtime_,
-      llvh::makeArrayRef(
-          reinterpret_cast<const uint8_t *>(utf8Name),
-          std::char_traits<char>::length(utf8Name)),
-      /*IgnoreInputErrors:*/ true);
-  if (strRes.getStatus() == vm::ExecutionStatus::EXCEPTION) {
-    return env->setJSException();
-  }
-
-  vm::CallResult<vm::Handle<vm::SymbolID>> symRes = vm::stringToSymbolID(
-      env->runtime_, vm::createPseudoHandle(strRes->getString()));
+  vm::CallResult<vm::Handle<vm::SymbolID>> symRes = utf8ToSymbolID(
+      env->runtime_, utf8Name, std::char_traits<char>::length(utf8Name));
   if (symRes.getStatus() == vm::ExecutionStatus::EXCEPTION) {
     return env->setJSException();
   }
@@ -4713,18 +4767,8 @@ napi_status NAPI_CDECL napi_has_named_property(
   vm::Handle<vm::JSObject> objHandle =
       env->runtime_.makeHandle<vm::JSObject>(*objRes);
 
-  vm::CallResult<vm::HermesValue> strRes = vm::StringPrimitive::createEfficient(
-      env->runtime_,
-      llvh::makeArrayRef(
-          reinterpret_cast<const uint8_t *>(utf8Name),
-          std::char_traits<char>::length(utf8Name)),
-      /*IgnoreInputErrors:*/ true);
-  if (strRes.getStatus() == vm::ExecutionStatus::EXCEPTION) {
-    return env->setJSException();
-  }
-
-  vm::CallResult<vm::Handle<vm::SymbolID>> symRes = vm::stringToSymbolID(
-      env->runtime_, vm::createPseudoHandle(strRes->getString()));
+  vm::CallResult<vm::Handle<vm::SymbolID>> symRes = utf8ToSymbolID(
+      env->runtime_, utf8Name, std::char_traits<char>::length(utf8Name));
   if (symRes.getStatus() == vm::ExecutionStatus::EXCEPTION) {
     return env->setJSException();
   }
@@ -4759,18 +4803,8 @@ napi_status NAPI_CDECL napi_get_named_property(
   vm::Handle<vm::JSObject> objHandle =
       env->runtime_.makeHandle<vm::JSObject>(*objRes);
 
-  vm::CallResult<vm::HermesValue> strRes = vm::StringPrimitive::createEfficient(
-      env->runtime_,
-      llvh::makeArrayRef(
-          reinterpret_cast<const uint8_t *>(utf8Name),
-          std::char_traits<char>::length(utf8Name)),
-      /*IgnoreInputErrors:*/ true);
-  if (strRes.getStatus() == vm::ExecutionStatus::EXCEPTION) {
-    return env->setJSException();
-  }
-
-  vm::CallResult<vm::Handle<vm::SymbolID>> symRes = vm::stringToSymbolID(
-      env->runtime_, vm::createPseudoHandle(strRes->getString()));
+  vm::CallResult<vm::Handle<vm::SymbolID>> symRes = utf8ToSymbolID(
+      env->runtime_, utf8Name, std::char_traits<char>::length(utf8Name));
   if (symRes.getStatus() == vm::ExecutionStatus::EXCEPTION) {
     return env->setJSException();
   }
@@ -5259,16 +5293,46 @@ napi_status NAPI_CDECL node_api_create_external_string_latin1(
     bool *copied) {
   CHECK_STATUS(checkGCPreconditions(env));
   CHECK_POSTCONDITIONS(env, /*valueStackDelta:*/ 1);
-  // TODO: Add support to Hermes for external strings.
-  CHECK_STATUS(napi_create_string_latin1(env, str, length, result));
-  if (finalizeCallback != nullptr) {
-    finalizeCallback(env, str, finalizeHint);
+  if (length > 0) {
+    CHECK_ARG(str);
+  }
+  CHECK_ARG(result);
+  if (length == NAPI_AUTO_LENGTH) {
+    length = std::char_traits<char>::length(str);
+  }
+  // Reject lengths that createBorrowed would fail on before the finalizer is
+  // attached, so that it never runs for a call that returns an error.
+  RETURN_STATUS_IF_FALSE(
+      length <= vm::StringPrimitive::MAX_STRING_LENGTH, napi_invalid_arg);
+
+  // One-byte Hermes strings can only hold ASCII characters, so other Latin1
+  // strings must be transcoded to UTF-16.
+  if (length == 0 || !::hermes::isAllASCII(str, str + length)) {
+    CHECK_STATUS(napi_create_string_latin1(env, str, length, result));
+    if (finalizeCallback != nullptr) {
+      finalizeCallback(env, str, finalizeHint);
+    }
+    if (copied != nullptr) {
+      // TODO: we report here false to pass the Node-API tests.
+      *copied = false;
+    }
+    return env->clearLastNativeError();
+  }
+
+  vm::GCScope gcScope{env->runtime_};
+
+  vm::CallResult<vm::HermesValue> strRes = vm::StringPrimitive::createBorrowed(
+      env->runtime_,
+      llvh::makeArrayRef(str, length),
+      makeExternalDataContext(
+          *env, str, length, finalizeCallback, finalizeHint));
+  if (strRes.getStatus() == vm::ExecutionStatus::EXCEPTION) {
+    return env->setJSException();
   }
   if (copied != nullptr) {
-    // TODO: we report here false to pass the Node-API tests.
     *copied = false;
   }
-  return env->clearLastNativeError();
+  return env->makeResultValue(*strRes, result);
 }
 
 napi_status NAPI_CDECL node_api_create_external_string_utf16(
@@ -5281,16 +5345,47 @@ napi_status NAPI_CDECL node_api_create_external_string_utf16(
     bool *copied) {
   CHECK_STATUS(checkGCPreconditions(env));
   CHECK_POSTCONDITIONS(env, /*valueStackDelta:*/ 1);
-  // TODO: Add support to Hermes for external strings.
-  CHECK_STATUS(napi_create_string_utf16(env, str, length, result));
-  if (finalizeCallback != nullptr) {
-    finalizeCallback(env, str, finalizeHint);
+  if (length > 0) {
+    CHECK_ARG(str);
+  }
+  CHECK_ARG(result);
+  if (length == NAPI_AUTO_LENGTH) {
+    length = std::char_traits<char16_t>::length(str);
+  }
+  // Reject lengths that createBorrowed would fail on before the finalizer is
+  // attached, so that it never runs for a call that returns an error.
+  RETURN_STATUS_IF_FALSE(
+      length <= vm::StringPrimitive::MAX_STRING_LENGTH, napi_invalid_arg);
+
+  if (length == 0) {
+    CHECK_STATUS(napi_create_string_utf16(env, str, length, result));
+    if (finalizeCallback != nullptr) {
+      finalizeCallback(env, str, finalizeHint);
+    }
+    if (copied != nullptr) {
+      *copied = false;
+    }
+    return env->clearLastNativeError();
+  }
+
+  vm::GCScope gcScope{env->runtime_};
+
+  vm::CallResult<vm::HermesValue> strRes = vm::StringPrimitive::createBorrowed(
+      env->runtime_,
+      llvh::makeArrayRef(str, length),
+      makeExternalDataContext(
+          *env,
+          str,
+          length * sizeof(char16_t),
+          finalizeCallback,
+          finalizeHint));
+  if (strRes.getStatus() == vm::ExecutionStatus::EXCEPTION) {
+    return env->setJSException();
   }
   if (copied != nullptr) {
-    // TODO: we report here false to pass the Node-API tests.
     *copied = false;
   }
-  return env->clearLastNativeError();
+  return env->makeResultValue(*strRes, result);
 }
 
 napi_status NAPI_CDECL node_api_create_property_key_latin1(
@@ -5313,18 +5408,8 @@ napi_status NAPI_CDECL node_api_create_property_key_latin1(
 
   vm::GCScope gcScope{env->runtime_};
 
-  vm::CallResult<vm::HermesValue> strRes =
-      ::hermes::isAllASCII(str, str + length)
-      ? vm::StringPrimitive::createEfficient(
-            env->runtime_, llvh::makeArrayRef(str, length))
-      : vm::StringPrimitive::createEfficient(
-            env->runtime_, latin1ToUtf16(str, length));
-  if (strRes.getStatus() == vm::ExecutionStatus::EXCEPTION) {
-    return env->setJSException();
-  }
-
-  vm::CallResult<vm::Handle<vm::SymbolID>> symRes = vm::stringToSymbolID(
-      env->runtime_, vm::createPseudoHandle(strRes->getString()));
+  vm::CallResult<vm::Handle<vm::SymbolID>> symRes =
+      latin1ToSymbolID(env->runtime_, str, length);
   if (symRes.getStatus() == vm::ExecutionStatus::EXCEPTION) {
     return env->setJSException();
   }
@@ -5358,16 +5443,8 @@ napi_status NAPI_CDECL node_api_create_property_key_utf8(
 
   vm::GCScope gcScope{env->runtime_};
 
-  vm::CallResult<vm::HermesValue> strRes = vm::StringPrimitive::createEfficient(
-      env->runtime_,
-      llvh::makeArrayRef(reinterpret_cast<const uint8_t *>(str), length),
-      /*IgnoreInputErrors:*/ true);
-  if (strRes.getStatus() == vm::ExecutionStatus::EXCEPTION) {
-    return env->setJSException();
-  }
-
-  vm::CallResult<vm::Handle<vm::SymbolID>> symRes = vm::stringToSymbolID(
-      env->runtime_, vm::createPseudoHandle(strRes->getString()));
+  vm::CallResult<vm::Handle<vm::SymbolID>> symRes =
+      utf8ToSymbolID(env->runtime_, str, length);
   if (symRes.getStatus() == vm::ExecutionStatus::EXCEPTION) {
     return env->setJSException();
   }
@@ -5401,14 +5478,11 @@ napi_status NAPI_CDECL node_api_create_property_key_utf16(
 
   vm::GCScope gcScope{env->runtime_};
 
-  vm::CallResult<vm::HermesValue> strRes = vm::StringPrimitive::createEfficient(
-      env->runtime_, llvh::makeArrayRef(str, length));
-  if (strRes.getStatus() == vm::ExecutionStatus::EXCEPTION) {
-    return env->setJSException();
-  }
-
-  vm::CallResult<vm::Handle<vm::SymbolID>> symRes = vm::stringToSymbolID(
-      env->runtime_, vm::createPseudoHandle(strRes->getString()));
+  // The identifier table hashes the characters directly, so no temporary
+  // StringPrimitive is allocated when the key is already interned.
+  vm::CallResult<vm::Handle<vm::SymbolID>> symRes =
+      env->runtime_.getIdentifierTable().getSymbolHandle(
+          env->runtime_, llvh::makeArrayRef(str, length));
   if (symRes.getStatus() == vm::ExecutionStatus::EXCEPTION) {
     return env->setJSException();
   }
@@ -0,0 +1,220 @@
+#!/bin/bash
+# Copyright (c) Meta Platforms, Inc. and affiliates.
+#
+# This source code is licensed under the MIT license found in the
+# LICENSE file in the root directory of this source tree.
+
+# lexer_throughput.sh — JavaScript lexer throughput benchmark.
+# Runs the compiler with -Xlexer-only over a corpus of JS files (by default
+# the octane benchmarks) and reports tokens, bytes and MB/s per file. The
+# time is measured inside the compiler around the lexing loop only, so
+# process startup and file I/O are excluded.
+#
+# Usage:
+#   lexer_throughput.sh <compiler_binary> [<file_or_dir>...] [--iterations N]
+#                       [--json] [--compare <compiler_b>]
+
+set -euo pipefail
+
+SCRIPT_DIR="$(cd "$(dirname "$0")" && pwd)"
+DEFAULT_CORPUS="$SCRIPT_DIR/../../benchmarks/octane"
+
+# Defaults
+COMPILER=""
+COMPILER_B=""
+ITERATIONS=5
+JSON_OUTPUT=false
+COMPARE_MODE=false
+INPUTS=()
+
+usage() {
+  cat <<EOF
+Usage: $(basename "$0") <compiler_binary> [<file_or_dir>...] [options]
+
+JavaScript lexer throughput benchmark.
+
+Arguments:
+  <compiler_binary>      Path to hermesc or shermes
+  <file_or_dir>          JS files or directories of JS files
+                         (default: benchmarks/octane)
+
+Options:
+  --iterations N         Runs per file; the fastest run is reported (default: 5)
+  --json                 Output structured JSON
+  --compare <compiler_b> A/B comparison with a second compiler binary
+  -h, --help             Show this help
+
+Uses -Xlexer-only, which tokenizes each input without parsing it and prints
+the number of tokens and the time spent lexing.
+
+Examples:
+  $(basename "$0") ./build/bin/hermesc
+  $(basename "$0") ./build/bin/hermesc bench/ --compare ./build2/bin/hermesc --json
+EOF
+  exit 0
+}
+
+# Parse arguments
+while [[ $# -gt 0 ]]; do
+  case "$1" in
+    --iterations) ITERATIONS="$2"; shift 2 ;;
+    --json) JSON_OUTPUT=true; shift ;;
+    --compare) COMPARE_MODE=true; COMPILER_B="$2"; shift 2 ;;
+    -h|--help) usage ;;
+    -*) echo "Error: Unknown option: $1" >&2; exit 1 ;;
+    *)
+      if [[ -z "$COMPILER" ]]; then
+        COMPILER="$1"
+      else
+        INPUTS+=("$1")
+      fi
+      shift
+      ;;
+  esac
+done
+
+if [[ -z "$COMPILER" ]]; then
+  echo "Error: compiler binary required" >&2
+  usage
+fi
+
+if [[ ! -x "$COMPILER" ]]; then
+  echo "Error: compiler binary not found or not executable: $COMPILER" >&2
+  exit 1
+fi
+
+if $COMPARE_MODE && [[ ! -x "$COMPILER_B" ]]; then
+  echo "Error: compiler binary not found or not executable: $COMPILER_B" >&2
+  exit 1
+fi
+
+if [[ ${#INPUTS[@]} -eq 0 ]]; then
+  INPUTS=("$DEFAULT_CORPUS")
+fi
+
+# Expand directories into the JS files they contain.
+FILES=()
+for input in "${INPUTS[@]}"; do
+  if [[ -d "$input" ]]; then
+    while IFS= read -r f; do
+      FILES+=("$f")
+    done < <(find "$input" -maxdepth 1 -name '*.js' | sort)
+  elif [[ -f "$input" ]]; then
+    FILES+=("$input")
+  else
+    echo "Error: input not found: $input" >&2
+    exit 1
+  fi
+done
+
+if [[ ${#FILES[@]} -eq 0 ]]; then
+  echo "Error: no JS files found" >&2
+  exit 1
+fi
+
+# Lex one file ITERATIONS times and print "<tokens> <bytes> <best_us>".
+measure_file() {
+  local compiler="$1"
+  local js_file="$2"
+  local best_us="" tokens=0 bytes=0
+  local i out us
+  for ((i = 0; i < ITERATIONS; i++)); do
+    if ! out=$("$compiler" -Xlexer-only "$js_file" 2>/dev/null); then
+      echo "Error: $compiler -Xlexer-only failed on $js_file" >&2
+      return 1
+    fi
+    tokens=$(echo "$out" | sed -n 's/^\([0-9]*\) tokens lexed$/\1/p')
+    bytes=$(echo "$out" | sed -n 's/^\([0-9]*\) bytes in [0-9]* us$/\1/p')
+    us=$(echo "$out" | sed -n 's/^[0-9]* bytes in \([0-9]*\) us$/\1/p')
+    if [[ -z "$us" ]]; then
+      echo "Error: $compiler does not report lexer timing" >&2
+      return 1
+    fi
+    if [[ -z "$best_us" ]] || ((us < best_us)); then
+      best_us=$us
+    fi
+  done
+  echo "$tokens $bytes $best_us"
+}
+
+# Measure every file with one compiler; print one "<file> <tokens> <bytes>
+# <us>" line per file.
+measure_all() {
+  local compiler="$1"
+  local f
+  for f in "${FILES[@]}"; do
+    echo "$f $(measure_file "$compiler" "$f")"
+  done
+}
+
+RESULTS_A=$(measure_all "$COMPILER")
+RESULTS_B=""
+if $COMPARE_MODE; then
+  RESULTS_B=$(measure_all "$COMPILER_B")
+fi
+
+python3 -c "
+import json
+import os
+import sys
+
+def parse(text):
+    rows = []
+    for line in text.strip().split('\n'):
+        if not line:
+            continue
+        path, tokens, size, us = line.rsplit(' ', 3)
+        us = max(int(us), 1)
+        rows.append({
+            'file': os.path.basename(path),
+            'tokens': int(tokens),
+            'bytes': int(size),
+            'time_us': us,
+            'mb_per_s': round(int(size) / us, 2),
+        })
+    return rows
+
+def summarize(rows):
+    size = sum(r['bytes'] for r in rows)
+    us = max(sum(r['time_us'] for r in rows), 1)
+    return {
+        'tokens': sum(r['tokens'] for r in rows),
+        'bytes': size,
+        'time_us': us,
+        'mb_per_s': round(size / us, 2),
+    }
+
+a = parse('''$RESULTS_A''')
+result = {'compiler': '$COMPILER', 'iterations': $ITERATIONS,
+          'files': a, 'total': summarize(a)}
+b = None
+if '$COMPARE_MODE' == 'true':
+    b = parse('''$RESULTS_B''')
+    result['compare'] = {'compiler': '$COMPILER_B', 'files': b,
+                         'total': summarize(b)}
+    result['speedup'] = round(
+        result['compare']['total']['mb_per_s'] /
+        max(result['total']['mb_per_s'], 0.01), 3)
+
+if '$JSON_OUTPUT' == 'true':
+    json.dump(result, sys.stdout, indent=2)
+    print()
+    sys.exit(0)
+
+print('=== Lexer Throughput ===')
+hdr = '%-20s %10s %10s %10s %10s' % ('File', 'Tokens', 'Bytes', 'Time(us)',
+                                     'MB/s')
+if b is not None:
+    hdr += ' %10s %8s' % ('MB/s (B)', 'Speedup')
+print(hdr)
+rows = list(zip(a, b)) if b is not None else [(r, None) for r in a]
+rows.append((result['total'], result['compare']['total'] if b else None))
+for i, (ra, rb) in enumerate(rows):
+    name = 'TOTAL' if i == len(rows) - 1 else ra['file']
+    line = '%-20s %10d %10d %10d %10.2f' % (name, ra['tokens'], ra['bytes'],
+                                            ra['time_us'], ra['mb_per_s'])
+    if rb is not None:
+        line += ' %10.2f %7.3fx' % (rb['mb_per_s'],
+                                    rb['mb_per_s'] / max(ra['mb_per_s'], 0.01))
+    print(line)
+"
@@ -0,0 +1,79 @@
+/**
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+// Benchmark for BigInt arithmetic on large values, used to tune the thresholds
+// of the subquadratic algorithms in lib/Support/BigIntSupport.cpp. BigInts are
+// limited to 1024 64-bit digits.
+
+function benchmark() {
+  let log = typeof print === "undefined" ? console.log : print;
+
+  // A pseudo-random BigInt with the given number of 64-bit digits.
+  let seed = 1;
+  function random(digits) {
+    let r = 0n;
+    for (let i = 0; i < digits * 2; i++) {
+      seed = (seed * 1103515245 + 12345) % 2147483648;
+      r = (r << 32n) | BigInt(seed * 2 + 1);
+    }
+    return r;
+  }
+
+  function run(name, iterations, fn) {
+    let start = Date.now();
+    for (let i = 0; i < iterations; i++) {
+      fn();
+    }
+    let elapsed = Date.now() - start;
+    log(`${name}: ${elapsed} ms`);
+  }
+
+  for (let digits of [16, 32, 64, 128, 256, 500]) {
+    let a = random(digits);
+    let b = random(digits);
+    run(`multiply ${digits}x${digits}`, (200000 / digits) | 0, () => a * b);
+  }
+
+  for (let digits of [32, 64, 128, 256, 500]) {
+    let a = random(2 * digits);
+    let b = random(digits);
+    run(`divide ${2 * digits}/${digits}`, (100000 / digits) | 0, () => a / b);
+  }
+
+  run("factorial 3000", 5, () => {
+    let r = 1n;
+    for (let i = 2n; i <= 3000n; i++) {
+      r *= i;
+    }
+    return r;
+  });
+
+  // RSA-style modular exponentiation with a 2048-bit modulus.
+  let modulus = random(32);
+  let base = random(31);
+  let exponent = random(32);
+  run("modpow 2048", 2, () => {
+    let result = 1n;
+    let b = base;
+    for (let e = exponent; e > 0n; e >>= 1n) {
+      if (e & 1n) {
+        result = (result * b) % modulus;
+      }
+      b = (b * b) % modulus;
+    }
+    return result;
+  });
+
+  let decimal = 7n ** 11000n;
+  run("toString(10) 10k digits", 20, () => decimal.toString());
+  run("toString(16) 10k digits", 20, () => decimal.toString(16));
+
+  let small = 123456789n;
+  run("small ops", 1000000, () => ((small * 3n) / 7n) % 1000n);
+}
+
+benchmark();
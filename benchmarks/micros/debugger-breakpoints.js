@@ -0,0 +1,41 @@
+/**
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+// Benchmark for the interpreter with a debugger attached. Compare an attached
+// run with hdb against one with a breakpoint that is never hit in the hot
+// function, and against a detached run:
+//
+//   printf 'continue\n' | hdb debugger-breakpoints.js
+//   printf 'break 26 7\ncontinue\n' | hdb debugger-breakpoints.js
+//   hermes -g debugger-breakpoints.js
+
+function callee(x) {
+  return x + 1;
+}
+
+function hot(n) {
+  let sum = 0;
+  for (let i = 0; i < n; i++) {
+    // Every call returns into a function with a breakpoint installed.
+    sum = callee(sum);
+    if (sum < 0) {
+      sum = 0;
+    }
+  }
+  return sum;
+}
+
+function benchmark() {
+  let log = typeof print === "undefined" ? console.log : print;
+  // Gives hdb a chance to set breakpoints.
+  debugger;
+  let start = Date.now();
+  hot(10000000);
+  log(`calls: ${Date.now() - start} ms`);
+}
+
+benchmark();
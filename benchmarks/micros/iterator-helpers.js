@@ -0,0 +1,40 @@
+/**
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+// Benchmark for chains of iterator helpers over array iterators, and for
+// Math.sumPrecise of an array.
+
+function benchmark() {
+  let log = typeof print === "undefined" ? console.log : print;
+  let values = [];
+  for (let i = 0; i < 10000; i++) {
+    values.push(i * 0.5);
+  }
+
+  let iterations = 100;
+  let total = 0;
+  let start = Date.now();
+  for (let i = 0; i < iterations; i++) {
+    total += values
+      .values()
+      .map(x => x * 2)
+      .filter(x => x % 3 !== 0)
+      .drop(10)
+      .take(5000)
+      .reduce((acc, x) => acc + x, 0);
+  }
+  log(`iterator helpers: ${Date.now() - start} ms, ${total}`);
+
+  total = 0;
+  start = Date.now();
+  for (let i = 0; i < iterations; i++) {
+    total += Math.sumPrecise(values);
+  }
+  log(`Math.sumPrecise: ${Date.now() - start} ms, ${total}`);
+}
+
+benchmark();
@@ -0,0 +1,87 @@
+/**
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+// Benchmark for promise reactions and the microtask drain. Run with the
+// microtask queue enabled (the default of the hermes CLI) to measure the native
+// Promise, and with -Xmicrotask-queue=0 to measure the polyfill. The allocated
+// bytes are reported when HermesInternal.getInstrumentedStats is available.
+
+function benchmark() {
+  let log = typeof print === "undefined" ? console.log : print;
+  let stats =
+    typeof HermesInternal === "object" && HermesInternal.getInstrumentedStats
+      ? () => HermesInternal.getInstrumentedStats().js_totalAllocatedBytes
+      : () => 0;
+  let n = 200000;
+
+  function report(name, start, startBytes) {
+    let elapsed = Date.now() - start;
+    let kb = ((stats() - startBytes) / 1024) | 0;
+    log(`${name}: ${elapsed} ms, ${kb} KB allocated`);
+  }
+
+  // Each case returns a promise which settles once all its jobs have run.
+  let cases = [
+    // A long chain of then() on promises which are already resolved.
+    ["then chain", () => {
+      let p = Promise.resolve(0);
+      for (let i = 0; i < n; i++) {
+        p = p.then(v => v + 1);
+      }
+      return p;
+    }],
+    // Many independent reactions, drained in one checkpoint.
+    ["fan out", () => {
+      let p = Promise.resolve(1);
+      let last;
+      for (let i = 0; i < n; i++) {
+        last = p.then(v => v);
+      }
+      return last;
+    }],
+    // Resolution with a promise, which goes through a thenable job.
+    ["adopt", () => {
+      let p = Promise.resolve(0);
+      for (let i = 0; i < n / 4; i++) {
+        p = new Promise(resolve => resolve(p));
+      }
+      return p;
+    }],
+    // An async function awaiting in a loop.
+    ["await loop", async () => {
+      let sum = 0;
+      for (let i = 0; i < n; i++) {
+        sum += await i;
+      }
+      return sum;
+    }],
+    ["all", () => {
+      let ps = [];
+      for (let i = 0; i < n; i++) {
+        ps.push(Promise.resolve(i));
+      }
+      return Promise.all(ps);
+    }],
+  ];
+
+  let i = 0;
+  function next() {
+    if (i === cases.length) {
+      return;
+    }
+    let [name, fn] = cases[i++];
+    let startBytes = stats();
+    let start = Date.now();
+    fn().then(() => {
+      report(name, start, startBytes);
+      next();
+    });
+  }
+  next();
+}
+
+benchmark();
@@ -0,0 +1,39 @@
+/**
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+// Benchmark for constructing RegExp objects from the same dynamic sources, as
+// router and validation libraries do. The hits and misses of the regexp cache
+// are reported when HermesInternal.getInstrumentedStats is available.
+
+function benchmark() {
+  let log = typeof print === "undefined" ? console.log : print;
+  let routes = [
+    "^/users/(?<id>[0-9]+)/?$",
+    "^/users/(?<id>[0-9]+)/posts/(?<post>[0-9a-f]{8})/?$",
+    "^/search\\?q=([^&]*)(?:&page=(\\d+))?$",
+    "^[\\w.+-]+@[\\w-]+\\.[\\w.-]+$",
+  ];
+  let paths = ["/users/42", "/users/42/posts/deadbeef", "/search?q=x", "a@b.c"];
+  let n = 200000;
+
+  let start = Date.now();
+  let matches = 0;
+  for (let i = 0; i < n; i++) {
+    let k = i % routes.length;
+    if (new RegExp(routes[k], "i").test(paths[k])) {
+      matches++;
+    }
+  }
+  log(`construct and test: ${Date.now() - start} ms, ${matches} matches`);
+
+  if (typeof HermesInternal === "object" && HermesInternal.getInstrumentedStats) {
+    let stats = HermesInternal.getInstrumentedStats();
+    log(`hits: ${stats.js_regExpCacheHits}, misses: ${stats.js_regExpCacheMisses}`);
+  }
+}
+
+benchmark();
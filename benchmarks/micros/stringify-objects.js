@@ -0,0 +1,36 @@
+/**
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+// Benchmark for JSON.stringify of many plain objects of the same shape, as in
+// a server handler serializing a response.
+
+function benchmark() {
+  let log = typeof print === "undefined" ? console.log : print;
+  let rows = [];
+  for (let i = 0; i < 1000; i++) {
+    rows.push({
+      id: i,
+      name: "user" + i,
+      email: "user" + i + "@example.com",
+      active: i % 3 !== 0,
+      score: i * 1.25,
+      tags: ["a", "b"],
+      address: {street: i + " Main St", city: "Springfield", zip: "12345"},
+    });
+  }
+  let response = {status: "ok", count: rows.length, rows: rows};
+
+  let iterations = 200;
+  let length = 0;
+  let start = Date.now();
+  for (let i = 0; i < iterations; i++) {
+    length += JSON.stringify(response).length;
+  }
+  log(`stringify objects: ${Date.now() - start} ms, ${length} chars`);
+}
+
+benchmark();
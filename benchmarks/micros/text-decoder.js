@@ -0,0 +1,68 @@
+/**
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+// Benchmark for TextDecoder.prototype.decode. Requires a build with the
+// contrib extensions enabled.
+
+function benchmark() {
+  let iterations = 200;
+  let log = typeof print === "undefined" ? console.log : print;
+  let size = 1 << 20;
+
+  // ASCII text, as in JSON or source code payloads.
+  let ascii = new Uint8Array(size);
+  for (let i = 0; i < size; i++) {
+    ascii[i] = 0x20 + (i % 95);
+  }
+
+  // Mostly ASCII with a two- and a three-byte sequence every 64 bytes.
+  let mixed = new Uint8Array(size);
+  for (let i = 0; i < size; i++) {
+    mixed[i] = 0x61 + (i % 26);
+  }
+  for (let i = 0; i + 5 <= size; i += 64) {
+    mixed.set([0xc3, 0xa9, 0xe2, 0x82, 0xac], i);
+  }
+
+  // UTF-16LE text outside of Latin-1.
+  let utf16 = new Uint8Array(size);
+  for (let i = 0; i < size; i += 2) {
+    utf16[i] = (i / 2) % 256;
+    utf16[i + 1] = 0x04;
+  }
+
+  // windows-1252 text with a high byte every 16 bytes.
+  let latin1 = ascii.slice();
+  for (let i = 0; i < size; i += 16) {
+    latin1[i] = 0xe9;
+  }
+
+  function run(name, decoder, bytes, chunkSize) {
+    let start = Date.now();
+    for (let i = 0; i < iterations; i++) {
+      if (chunkSize) {
+        for (let off = 0; off < bytes.length; off += chunkSize) {
+          decoder.decode(bytes.subarray(off, off + chunkSize), {stream: true});
+        }
+        decoder.decode();
+      } else {
+        decoder.decode(bytes);
+      }
+    }
+    let elapsed = Date.now() - start;
+    let mbPerSec = ((bytes.length * iterations) / 1e6 / (elapsed / 1000)) | 0;
+    log(`${name}: ${elapsed} ms, ${mbPerSec} MB/s`);
+  }
+
+  run("utf-8 ascii", new TextDecoder(), ascii);
+  run("utf-8 mixed", new TextDecoder(), mixed);
+  run("utf-8 mixed stream", new TextDecoder(), mixed, 4093);
+  run("utf-16le", new TextDecoder("utf-16le"), utf16);
+  run("windows-1252", new TextDecoder("latin1"), latin1);
+}
+
+benchmark();
@@ -8,6 +8,8 @@
 #pragma once
 
 #include <cassert>
+#include <cstddef>
+#include <cstdint>
 #include <deque>
 #include <vector>
 
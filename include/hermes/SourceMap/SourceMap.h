@@ -14,10 +14,13 @@
 #include "llvh/ADT/DenseMap.h"
 #include "llvh/Support/raw_ostream.h"
 
+#include <memory>
 #include <vector>
 
 namespace hermes {
 
+class SourceMapIndex;
+
 /// Represent a source location in original JS source file.
 /// It is different from DebugSourceLocation that it may hold string
 /// names not existing in string table.
@@ -130,6 +133,17 @@ class SourceMap {
       std::vector<SegmentList> &&lines,
       MetadataList &&sourcesMetadata);
 
+  /// Construct a source map whose segments are decoded on demand from
+  /// \p index. The other parameters are as above.
+  SourceMap(
+      llvh::StringRef sourceRoot,
+      llvh::StringRef originalSourceRoot,
+      std::vector<std::string> &&sources,
+      std::unique_ptr<SourceMapIndex> index,
+      MetadataList &&sourcesMetadata);
+
+  ~SourceMap();
+
   /// Query source map text location for \p line and \p column.
   /// In both the input and output of this function, line and column numbers
   /// are 1-based.
@@ -151,6 +165,17 @@ class SourceMap {
       uint32_t line,
       uint32_t column) const;
 
+  /// \return true if segments are decoded on demand rather than up front.
+  bool isLazy() const {
+    return index_ != nullptr;
+  }
+
+  /// Write the source root, the source paths and the mappings of a lazy
+  /// source map to \p OS in the binary index format that
+  /// SourceMapParser::loadIndex() reads. Source metadata is not included.
+  /// \return false if this source map is not lazy.
+  bool writeIndex(llvh::raw_ostream &OS) const;
+
   /// \return the sourceRoot field of the source map.
   llvh::StringRef getSourceRoot() const {
     return sourceRoot_;
@@ -211,9 +236,15 @@ class SourceMap {
 
   std::vector<std::string> rootedSources_{};
 
-  /// The list of segments in VLQ scheme.
+  /// Prepend sourceRoot_ to sources_ to populate rootedSources_.
+  void initRootedSources();
+
+  /// The list of segments in VLQ scheme. Empty if index_ is set.
   std::vector<SegmentList> lines_;
 
+  /// Index to decode segments from on demand, for lazy source maps.
+  std::unique_ptr<SourceMapIndex> index_;
+
   /// Metadata for each source keyed by source index. Represents the
   /// x_facebook_sources field in the JSON source map.
   MetadataList sourcesMetadata_;
@@ -0,0 +1,143 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#ifndef HERMES_SOURCEMAP_SOURCEMAPINDEX_H
+#define HERMES_SOURCEMAP_SOURCEMAPINDEX_H
+
+#include "hermes/ADT/SimpleLRU.h"
+#include "hermes/SourceMap/SourceMap.h"
+
+#include "llvh/ADT/ArrayRef.h"
+#include "llvh/ADT/DenseMap.h"
+#include "llvh/Support/Endian.h"
+#include "llvh/Support/MemoryBuffer.h"
+
+#include <memory>
+#include <mutex>
+#include <string>
+
+namespace hermes {
+
+/// An index over the VLQ encoded "mappings" of a source map, which decodes
+/// segments on demand instead of materializing all of them up front.
+///
+/// The segments of every generated line are split into blocks of up to
+/// kSegmentsPerBlock segments. For each block, the index records where it
+/// starts in the mappings and the delta decoding state at that point, so a
+/// query only has to decode a single block. Recently decoded blocks are kept
+/// in an LRU cache.
+///
+/// The index can be serialized together with the mappings and the source
+/// paths. The serialized form is read in place, so a memory mapped index
+/// file is usable without decoding anything.
+class SourceMapIndex {
+ public:
+  /// Maximum number of segments in a block.
+  static constexpr uint32_t kSegmentsPerBlock = 64;
+
+  /// Maximum number of decoded blocks kept in the cache.
+  static constexpr uint32_t kCachedBlocks = 256;
+
+  /// The start of a block. This is also the serialized representation, so all
+  /// fields are little endian and unaligned.
+  struct Checkpoint {
+    /// Offset of the first segment of the block in the mappings.
+    llvh::support::ulittle32_t offset;
+    /// Generated column of the first segment of the block.
+    llvh::support::little32_t firstColumn;
+    /// Delta decoding state before the first segment of the block.
+    llvh::support::little32_t generatedColumn;
+    llvh::support::little32_t sourceIndex;
+    llvh::support::little32_t representedLine;
+    llvh::support::little32_t representedColumn;
+    llvh::support::little32_t nameIndex;
+  };
+
+  /// Validate and index \p mappings, the "mappings" field of a source map.
+  /// \return the index, or nullptr if the mappings are malformed.
+  static std::unique_ptr<SourceMapIndex> build(std::string mappings);
+
+  /// \return true if \p data starts like a serialized index.
+  static bool isSerialized(llvh::StringRef data);
+
+  /// Read the serialized index in \p buffer, which is retained and used in
+  /// place. The source root and source paths that were stored with the index
+  /// are returned in \p sourceRoot and \p sources.
+  /// \return the index, or nullptr with \p error set if the buffer is not a
+  ///   valid serialized index.
+  static std::unique_ptr<SourceMapIndex> read(
+      std::unique_ptr<llvh::MemoryBuffer> buffer,
+      std::string &sourceRoot,
+      std::vector<std::string> &sources,
+      std::string &error);
+
+  /// Serialize this index together with \p sourceRoot and \p sources to \p OS.
+  void write(
+      llvh::raw_ostream &OS,
+      llvh::StringRef sourceRoot,
+      llvh::ArrayRef<std::string> sources) const;
+
+  /// \return the number of generated lines.
+  uint32_t getNumLines() const {
+    return lineStarts_.size() - 1;
+  }
+
+  /// Query source map segment for \p line and \p column, with the same
+  /// semantics as SourceMap::getSegmentForAddress(). Safe to call from
+  /// multiple threads.
+  llvh::Optional<SourceMap::Segment> getSegmentForAddress(
+      uint32_t line,
+      uint32_t column) const;
+
+ private:
+  /// A decoded block in the cache.
+  struct CachedBlock {
+    uint32_t block = 0;
+    SourceMap::SegmentList segments{};
+  };
+
+  SourceMapIndex() = default;
+
+  /// Decode the segments of block \p block into \p segments.
+  void decodeBlock(uint32_t block, SourceMap::SegmentList &segments) const;
+
+  /// \return the decoded segments of block \p block, from the cache if
+  ///   possible.
+  /// \pre cacheMutex_ is held.
+  const SourceMap::SegmentList &getBlock(uint32_t block) const;
+
+  /// The serialized index, if the index was read from one.
+  std::unique_ptr<llvh::MemoryBuffer> buffer_{};
+
+  /// Storage for the mappings and arrays below, if the index was built.
+  std::string ownedMappings_{};
+  std::vector<llvh::support::ulittle32_t> ownedLineStarts_{};
+  std::vector<Checkpoint> ownedCheckpoints_{};
+
+  /// The VLQ encoded mappings.
+  llvh::StringRef mappings_{};
+
+  /// Index of the first block of every generated line, followed by the total
+  /// number of blocks. A line without segments has no blocks.
+  llvh::ArrayRef<llvh::support::ulittle32_t> lineStarts_{};
+
+  /// The start of every block.
+  llvh::ArrayRef<Checkpoint> checkpoints_{};
+
+  /// Protects the cache below.
+  mutable std::mutex cacheMutex_{};
+
+  /// Decoded blocks in least recently used order.
+  mutable SimpleLRU<CachedBlock> lru_{};
+
+  /// Maps a block index to its entry in lru_.
+  mutable llvh::DenseMap<uint32_t, CachedBlock *> cached_{};
+};
+
+} // namespace hermes
+
+#endif // HERMES_SOURCEMAP_SOURCEMAPINDEX_H
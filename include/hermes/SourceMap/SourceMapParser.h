@@ -21,13 +21,33 @@ class SourceMapParser {
  public:
   /// Parse input \p sourceMap and return parsed SourceMap. \p sourceMap must
   /// have a past-the-end null terminator.
+  /// If \p lazy is true, the mappings are validated and indexed, but segments
+  /// are only decoded when they are queried. This is much cheaper for large
+  /// source maps of which only a few locations are looked up.
   /// On failure if malformed, prints an error message and returns nullptr.
   static std::unique_ptr<SourceMap> parse(
       llvh::MemoryBufferRef sourceMap,
       llvh::StringRef baseDir,
+      SourceErrorManager &sm,
+      bool lazy = false);
+
+  /// \return true if \p buffer holds a binary source map index written by
+  ///   SourceMap::writeIndex() rather than a JSON source map.
+  static bool isIndex(llvh::MemoryBufferRef buffer);
+
+  /// Load a source map from the binary index in \p buffer, as written by
+  /// SourceMap::writeIndex(). The buffer is used in place and retained by the
+  /// returned SourceMap, so a memory mapped file can be loaded without
+  /// copying or decoding it.
+  /// On failure if malformed, prints an error message and returns nullptr.
+  static std::unique_ptr<SourceMap> loadIndex(
+      std::unique_ptr<llvh::MemoryBuffer> buffer,
+      llvh::StringRef baseDir,
       SourceErrorManager &sm);
 
  private:
+  friend class SourceMapIndex;
+
   SourceMapParser() = delete;
   SourceMapParser(SourceMapParser &) = delete;
   SourceMapParser(SourceMapParser &&) = delete;
@@ -49,6 +69,9 @@ class SourceMapParser {
       llvh::StringRef sourceMappings,
       std::vector<SourceMap::SegmentList> &lines);
 
+  /// Update \p state after decoding \p segment.
+  static void updateState(State &state, const SourceMap::Segment &segment);
+
   /// Parse single segment in mapping.
   static llvh::Optional<SourceMap::Segment>
   parseSegment(const State &state, const char *&pCur, const char *pSegEnd);
@@ -0,0 +1,57 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#pragma once
+
+#include <cstdint>
+
+namespace hermes {
+
+/// Scan forward from \p cur for the end of a run of ASCII identifier part
+/// characters, that is [A-Za-z0-9_$] or \p extra.
+/// \pre cur <= end, and [cur, end) is readable.
+/// \return a pointer to the first character in [cur, end) that is not an
+///   identifier part, or \p end if there is none.
+const char *scanASCIIIdentifierChars(
+    const char *cur,
+    const char *end,
+    char extra);
+
+/// Scan forward from \p cur for the end of a run of spaces and tabs.
+/// \pre cur <= end, and [cur, end) is readable.
+/// \return a pointer to the first character in [cur, end) that is neither a
+///   space nor a tab, or \p end if there is none.
+const char *skipSpacesAndTabs(const char *cur, const char *end);
+
+/// Scan forward from \p cur for a character that needs special handling in a
+/// string literal or comment body: \p stop1, \p stop2, '\n', '\r', '\0' or a
+/// byte that starts a multi-byte UTF-8 sequence. Callers that only need one
+/// stop character may pass it twice.
+/// \pre cur <= end, and [cur, end) is readable.
+/// \return a pointer to the first such character in [cur, end), or \p end if
+///   there is none.
+const char *scanUntilSpecialChar(
+    const char *cur,
+    const char *end,
+    char stop1,
+    char stop2);
+
+/// Scan forward from \p cur for the end of a run of ASCII bytes.
+/// \pre cur <= end, and [cur, end) is readable.
+/// \return a pointer to the first byte in [cur, end) that has the high bit
+///   set, or \p end if there is none.
+const uint8_t *scanASCII(const uint8_t *cur, const uint8_t *end);
+
+/// Scan forward from \p cur for a character that must be escaped in a JSON
+/// string: '"', '\\' or a control character below 0x20. Bytes with the high
+/// bit set also end the run.
+/// \pre cur <= end, and [cur, end) is readable.
+/// \return a pointer to the first such character in [cur, end), or \p end if
+///   there is none.
+const char *scanUntilJSONEscape(const char *cur, const char *end);
+
+} // namespace hermes
@@ -115,6 +115,13 @@ void vm_unused(void *p, size_t sz);
 /// so that the OS may prefetch it. \p p must be page-aligned.
 void vm_prefetch(void *p, size_t sz);
 
+/// Fault in every page of the \p sz byte region of memory starting at \p p,
+/// so that later accesses to it do not take page faults. The contents of the
+/// region are unchanged.
+/// \pre p must be page-aligned, and the region must be committed and
+///   writable.
+void vm_populate(void *p, size_t sz);
+
 /// Assign a \p name to the \p sz byte region of virtual memory starting at
 /// pointer \p p.  The name is assigned only on supported platforms (currently
 /// only Android).  This name appears when the OS is queried about the mapping
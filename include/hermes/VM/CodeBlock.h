@@ -76,6 +76,11 @@ class CodeBlock final : private llvh::TrailingObjects<
 #ifdef HERMES_ENABLE_DEBUGGER
   /// The number of breakpoints currently installed in this function.
   uint32_t numInstalledBreakpoints_ = 0;
+
+  /// A copy of the opcode array, taken when the first breakpoint is installed
+  /// and dropped when the last one is uninstalled. It holds the real opcodes
+  /// of the instructions that are patched with Debugger instructions.
+  std::unique_ptr<hbc::opcode_atom_t[]> originalOpcodes_;
 #endif
 
   /// Total size of the property caches.
@@ -384,6 +389,17 @@ class CodeBlock final : private llvh::TrailingObjects<
   uint32_t getNumInstalledBreakpoints() const {
     return numInstalledBreakpoints_;
   }
+
+  /// \return the opcode of the instruction at \p offset, ignoring any
+  /// breakpoint installed there.
+  inst::OpCode getRealOpCode(uint32_t offset) const {
+    assert(
+        offset < functionHeader_.getBytecodeSizeInBytes() &&
+        "opCode offset out of bounds");
+    const hbc::opcode_atom_t *opcodes =
+        originalOpcodes_ ? originalOpcodes_.get() : bytecode_;
+    return static_cast<inst::OpCode>(opcodes[offset]);
+  }
 #endif
 };
 
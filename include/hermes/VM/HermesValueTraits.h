@@ -60,6 +60,8 @@ HERMES_VM_GCOBJECT(JSObject);
 HERMES_VM_GCOBJECT(JSProxy);
 HERMES_VM_GCOBJECT(JSRegExp);
 HERMES_VM_GCOBJECT(JSRegExpStringIterator);
+HERMES_VM_GCOBJECT(JSIteratorHelper);
+HERMES_VM_GCOBJECT(JSWrapForValidIterator);
 HERMES_VM_GCOBJECT(JSString);
 HERMES_VM_GCOBJECT(JSStringIterator);
 HERMES_VM_GCOBJECT(JSSymbol);
@@ -68,6 +70,7 @@ HERMES_VM_GCOBJECT(JSWeakMapImplBase);
 HERMES_VM_GCOBJECT(JSWeakRef);
 HERMES_VM_GCOBJECT(FinalizationRecord);
 HERMES_VM_GCOBJECT(JSFinalizationRegistry);
+HERMES_VM_GCOBJECT(JSPromise);
 HERMES_VM_GCOBJECT(NativeJSFunction);
 HERMES_VM_GCOBJECT(NativeJSClass);
 HERMES_VM_GCOBJECT(NativeConstructor);
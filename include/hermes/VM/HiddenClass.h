@@ -288,6 +288,10 @@ class HiddenClass final : public GCCell {
   /// Never used in dictionary mode.
   GCPointer<ArrayStorageSmall> forInCache_{};
 
+  /// Cache of the keys of objects of this class, and the quoted "key":
+  /// fragments, that JSON.stringify writes. Never used in dictionary mode.
+  GCPointer<ArrayStorageSmall> jsonStringifyCache_{};
+
   /// The symbol that was added when transitioning to this hidden class.
   const GCSymbolID symbolID_;
   /// The flags of the added symbol.
@@ -424,6 +428,16 @@ class HiddenClass final : public GCCell {
     forInCache_.setNull(runtime.getHeap());
   }
 
+  /// \return The JSON.stringify cache if one has been set, otherwise nullptr.
+  ArrayStorageSmall *getJSONStringifyCache(Runtime &runtime) const {
+    return jsonStringifyCache_.get(runtime);
+  }
+
+  void setJSONStringifyCache(ArrayStorageSmall *arr, Runtime &runtime) {
+    assert(!isDictionary() && "JSON.stringify cache in dictionary mode");
+    jsonStringifyCache_.set(runtime, arr, runtime.getHeap());
+  }
+
   /// Reset the property map, unless this class is in dictionary mode or typed.
   /// May be called by the GC for any HiddenClass not in a Handle.
   void clearPropertyMap(GC &gc) {
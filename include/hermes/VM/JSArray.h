@@ -489,6 +489,14 @@ class JSArrayIterator : public JSObject {
       Handle<JSArrayIterator> self,
       Runtime &runtime);
 
+  /// Iterate to the next element, without creating an iterator result object.
+  /// \param[out] value the next element.
+  /// \return false if the iteration has completed.
+  static CallResult<bool> nextValue(
+      Handle<JSArrayIterator> self,
+      Runtime &runtime,
+      PinnedValue<> *value);
+
  public:
   JSArrayIterator(
       Runtime &runtime,
@@ -0,0 +1,186 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#ifndef HERMES_VM_JSITERATORHELPER_H
+#define HERMES_VM_JSITERATORHELPER_H
+
+#include "hermes/VM/Callable.h"
+#include "hermes/VM/JSObject.h"
+
+namespace hermes {
+namespace vm {
+
+/// ES2025 27.1.2.1 Iterator Helper objects, returned by the lazy methods of
+/// Iterator.prototype. The spec describes them as generators running an
+/// abstract closure; here the state of each closure is kept in fields, and
+/// every call to next() runs the closure up to its next yield.
+class JSIteratorHelper : public JSObject {
+  using Super = JSObject;
+
+  friend void JSIteratorHelperBuildMeta(
+      const GCCell *cell,
+      Metadata::Builder &mb);
+
+ public:
+  /// The Iterator.prototype method which created the helper.
+  enum class Kind : uint8_t { Map, Filter, Take, Drop, FlatMap };
+
+  /// [[GeneratorState]]
+  enum class State : uint8_t { SuspendedStart, SuspendedYield, Running, Done };
+
+  static const ObjectVTable vt;
+
+  static constexpr CellKind getCellKind() {
+    return CellKind::JSIteratorHelperKind;
+  }
+  static bool classof(const GCCell *cell) {
+    return cell->getKind() == CellKind::JSIteratorHelperKind;
+  }
+
+  /// Create a helper of \p kind over the iterator record (\p iterated,
+  /// \p nextMethod). \p fn is the mapper or predicate, and \p limit the
+  /// number of values to take or drop.
+  static PseudoHandle<JSIteratorHelper> create(
+      Runtime &runtime,
+      Kind kind,
+      Handle<JSObject> iterated,
+      Handle<> nextMethod,
+      Handle<Callable> fn,
+      double limit);
+
+  /// Run the closure of the helper up to its next yield.
+  /// \param[out] value the yielded value.
+  /// \return false if the closure returned instead of yielding.
+  static CallResult<bool> step(
+      Handle<JSIteratorHelper> self,
+      Runtime &runtime,
+      PinnedValue<> *value);
+
+  /// ES2025 27.1.2.1.1 %IteratorHelperPrototype%.next ( )
+  static CallResult<HermesValue> next(
+      Handle<JSIteratorHelper> self,
+      Runtime &runtime);
+
+  /// ES2025 27.1.2.1.2 %IteratorHelperPrototype%.return ( )
+  static CallResult<HermesValue> returnImpl(
+      Handle<JSIteratorHelper> self,
+      Runtime &runtime);
+
+ public:
+  JSIteratorHelper(
+      Runtime &runtime,
+      Handle<JSObject> parent,
+      Handle<HiddenClass> clazz,
+      Kind kind,
+      Handle<JSObject> iterated,
+      Handle<> nextMethod,
+      Handle<Callable> fn,
+      double limit)
+      : JSObject(runtime, *parent, *clazz),
+        iterated_(runtime, *iterated, runtime.getHeap()),
+        nextMethod_(*nextMethod, runtime.getHeap()),
+        fn_(runtime, fn.get(), runtime.getHeap()),
+        remaining_(limit),
+        kind_(kind) {}
+
+ private:
+  /// Run the closure of the helper while it is marked as running.
+  static CallResult<bool> run(
+      Handle<JSIteratorHelper> self,
+      Runtime &runtime,
+      PinnedValue<> *value);
+
+  /// [[UnderlyingIterators]]: the iterator the helper was created on, and its
+  /// next method.
+  GCPointer<JSObject> iterated_;
+  GCHermesValue nextMethod_;
+
+  /// The mapper or predicate, null for take and drop.
+  GCPointer<Callable> fn_;
+
+  /// The iterator returned by the mapper of flatMap which is being iterated,
+  /// and its next method. Null between two inner iterators.
+  GCPointer<JSObject> inner_{};
+  GCHermesValue innerNextMethod_{};
+
+  /// The counter passed to the mapper or predicate.
+  double counter_{0};
+
+  /// The number of values still to take or drop.
+  double remaining_;
+
+  Kind kind_;
+
+  State state_{State::SuspendedStart};
+};
+
+/// ES2025 27.1.3.2.1.1 %WrapForValidIteratorPrototype% objects, returned by
+/// Iterator.from for iterators which do not inherit from Iterator.prototype.
+class JSWrapForValidIterator : public JSObject {
+  using Super = JSObject;
+
+  friend void JSWrapForValidIteratorBuildMeta(
+      const GCCell *cell,
+      Metadata::Builder &mb);
+
+ public:
+  static const ObjectVTable vt;
+
+  static constexpr CellKind getCellKind() {
+    return CellKind::JSWrapForValidIteratorKind;
+  }
+  static bool classof(const GCCell *cell) {
+    return cell->getKind() == CellKind::JSWrapForValidIteratorKind;
+  }
+
+  static PseudoHandle<JSWrapForValidIterator>
+  create(Runtime &runtime, Handle<JSObject> iterated, Handle<> nextMethod);
+
+  /// \return [[Iterated]].[[Iterator]].
+  JSObject *getIterated(Runtime &runtime) const {
+    return iterated_.getNonNull(runtime);
+  }
+
+  /// \return [[Iterated]].[[NextMethod]].
+  HermesValue getNextMethod() const {
+    return nextMethod_;
+  }
+
+ public:
+  JSWrapForValidIterator(
+      Runtime &runtime,
+      Handle<JSObject> parent,
+      Handle<HiddenClass> clazz,
+      Handle<JSObject> iterated,
+      Handle<> nextMethod)
+      : JSObject(runtime, *parent, *clazz),
+        iterated_(runtime, *iterated, runtime.getHeap()),
+        nextMethod_(*nextMethod, runtime.getHeap()) {}
+
+ private:
+  /// [[Iterated]]
+  GCPointer<JSObject> iterated_;
+  GCHermesValue nextMethod_;
+};
+
+/// ES2025 7.4.10 IteratorStepValue, on an iterator record obtained by
+/// GetIteratorDirect, whose \p nextMethod need not be callable. Array
+/// iterators and iterator helpers whose next method is the original one are
+/// stepped directly, without allocating iterator result objects.
+/// \param[out] value the next value. If null, the value is not read from the
+///   iterator result, as in IteratorStep.
+/// \return false if the iterator is done.
+CallResult<bool> iteratorStepValueDirect(
+    Runtime &runtime,
+    Handle<JSObject> iterator,
+    Handle<> nextMethod,
+    PinnedValue<> *value);
+
+} // namespace vm
+} // namespace hermes
+
+#endif // HERMES_VM_JSITERATORHELPER_H
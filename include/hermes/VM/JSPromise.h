@@ -0,0 +1,209 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#ifndef HERMES_VM_JSPROMISE_H
+#define HERMES_VM_JSPROMISE_H
+
+#include "hermes/VM/ArrayStorage.h"
+#include "hermes/VM/CallResult.h"
+#include "hermes/VM/Callable.h"
+#include "hermes/VM/JSObject.h"
+#include "hermes/VM/Runtime.h"
+
+namespace hermes {
+namespace vm {
+
+/// A Promise object (ES2024 27.2.6).
+///
+/// Reactions registered while the promise is pending are stored in the promise
+/// itself: the first one inline, and any further ones in an ArrayStorage. When
+/// the promise is settled, each reaction is enqueued as a Runtime::Job without
+/// allocating anything on the JS heap.
+///
+/// A PromiseCapability Record is represented by a HermesValue, which is one
+/// of:
+/// - a JSPromise created for the intrinsic %Promise% constructor without
+///   resolving functions. It is settled directly, which is safe because no
+///   resolving functions for it can be reached from JS.
+/// - an ArrayStorage with the [[Promise]], [[Resolve]] and [[Reject]] fields,
+///   for any other capability.
+/// - undefined, for the absence of a capability.
+class JSPromise final : public JSObject {
+ public:
+  using Super = JSObject;
+  static const ObjectVTable vt;
+
+  /// ES2024 27.2.6 [[PromiseState]].
+  enum class State : uint8_t { Pending, Fulfilled, Rejected };
+
+  /// Indexes of the fields of a capability stored in an ArrayStorage.
+  enum CapabilityField { CapPromise, CapResolve, CapReject, CapCount };
+
+  /// Additional slots of the resolving functions: the promise to resolve,
+  /// or undefined once [[AlreadyResolved]] is set, and the other function.
+  enum ResolvingFunctionSlot { RFPromise, RFSibling, RFCount };
+
+  /// Additional slots of the GetCapabilitiesExecutor functions.
+  enum ExecutorSlot { ExecutorResolve, ExecutorReject, ExecutorSlotCount };
+
+  static constexpr CellKind getCellKind() {
+    return CellKind::JSPromiseKind;
+  }
+
+  static bool classof(const GCCell *cell) {
+    return cell->getKind() == CellKind::JSPromiseKind;
+  }
+
+  /// Create a new pending promise with prototype \p parentHandle.
+  static PseudoHandle<JSPromise> create(
+      Runtime &runtime,
+      Handle<JSObject> parentHandle);
+
+  State getState() const {
+    return state_;
+  }
+
+  /// \return the value or the reason of a settled promise.
+  HermesValue getResult() const {
+    assert(state_ != State::Pending && "pending promise has no result");
+    return result_;
+  }
+
+  /// ES2024 27.2.1.3 CreateResolvingFunctions. The functions are stored in
+  /// \p resolve and \p reject.
+  static void createResolvingFunctions(
+      Runtime &runtime,
+      Handle<JSPromise> self,
+      MutableHandle<NativeFunction> resolve,
+      MutableHandle<NativeFunction> reject);
+
+  /// ES2024 27.2.1.3.2 Promise Resolve Functions, steps 7 to 16: resolve
+  /// \p self with \p resolution. [[AlreadyResolved]] is handled by the caller.
+  /// \return EXCEPTION only if an uncatchable error was thrown, or if the
+  ///   rejection tracker threw.
+  static ExecutionStatus
+  resolve(Runtime &runtime, Handle<JSPromise> self, Handle<> resolution);
+
+  /// ES2024 27.2.1.7 RejectPromise.
+  /// \return EXCEPTION if the rejection tracker threw.
+  static ExecutionStatus
+  reject(Runtime &runtime, Handle<JSPromise> self, Handle<> reason);
+
+  /// ES2024 27.2.5.4.1 PerformPromiseThen. Handlers that are not callable are
+  /// ignored.
+  /// \param capability the capability of the derived promise, as described
+  ///   above.
+  /// \return EXCEPTION if the rejection tracker threw.
+  static ExecutionStatus performThen(
+      Runtime &runtime,
+      Handle<JSPromise> self,
+      Handle<> onFulfilled,
+      Handle<> onRejected,
+      Handle<> capability);
+
+  /// ES2024 27.2.1.5 NewPromiseCapability(C). When \p C is the intrinsic
+  /// %Promise% and \p needFunctions is false, this only allocates the promise.
+  /// \return the capability, as described above.
+  static CallResult<HermesValue> newPromiseCapability(
+      Runtime &runtime,
+      Handle<> C,
+      bool needFunctions = false);
+
+  /// \return the [[Promise]] of the (defined) \p capability.
+  static HermesValue capabilityPromise(HermesValue capability);
+
+  /// Call the [[Resolve]] or the [[Reject]] function of \p capability with
+  /// \p value, depending on \p isReject.
+  static ExecutionStatus settleCapability(
+      Runtime &runtime,
+      Handle<> capability,
+      Handle<> value,
+      bool isReject);
+
+  /// Take the value that was just thrown and settle \p capability with it as
+  /// a rejection.
+  /// \return EXCEPTION if the thrown value is uncatchable, leaving it thrown,
+  ///   or if rejecting threw.
+  static ExecutionStatus rejectCapabilityWithThrownValue(
+      Runtime &runtime,
+      Handle<> capability);
+
+  /// ES2024 7.3.22 SpeciesConstructor(promise, %Promise%). Hermes doesn't
+  /// implement @@species, so the "constructor" of \p promise is used if it is
+  /// a constructor, as if it inherited Promise[@@species].
+  static CallResult<HermesValue> speciesConstructor(
+      Runtime &runtime,
+      Handle<JSObject> promise);
+
+  /// ES2024 27.2.4.7.1 PromiseResolve(C, x).
+  static CallResult<HermesValue>
+  promiseResolve(Runtime &runtime, Handle<> C, Handle<> x);
+
+  /// Run the promise Job of kind \p kind with the operands \p callee,
+  /// \p argument and \p target. See Runtime::Job::Kind.
+  static ExecutionStatus runJob(
+      Runtime &runtime,
+      Runtime::Job::Kind kind,
+      Handle<> callee,
+      Handle<> argument,
+      Handle<> target);
+
+  friend void JSPromiseBuildMeta(const GCCell *cell, Metadata::Builder &mb);
+
+  JSPromise(Runtime &runtime, Handle<JSObject> parent, Handle<HiddenClass> clazz)
+      : JSObject(runtime, *parent, *clazz) {}
+
+ private:
+  /// ES2024 27.2.1.4 FulfillPromise and 27.2.1.7 RejectPromise, steps 2-7.
+  /// Settle \p self with \p result and trigger its reactions.
+  static void settle(
+      Runtime &runtime,
+      Handle<JSPromise> self,
+      State state,
+      Handle<> result);
+
+  /// ES2024 27.2.1.9 HostPromiseRejectionTracker. Notify the tracker that was
+  /// registered through HermesInternal, if any.
+  /// \param isHandle true for the "handle" operation, false for "reject".
+  static ExecutionStatus
+  trackRejection(Runtime &runtime, Handle<JSPromise> self, bool isHandle);
+
+  /// ES2024 27.2.1.8 TriggerPromiseReactions for one reaction.
+  static void enqueueReaction(
+      Runtime &runtime,
+      State state,
+      HermesValue result,
+      HermesValue onFulfilled,
+      HermesValue onRejected,
+      HermesValue capability);
+
+  /// [[PromiseResult]], once settled.
+  GCHermesValue result_{};
+
+  /// The first reaction registered while pending: its two handlers (or
+  /// undefined) and its capability. Valid if hasReaction_ is set.
+  GCHermesValue onFulfilled_{};
+  GCHermesValue onRejected_{};
+  GCHermesValue capability_{};
+
+  /// The reactions registered after the first one, as consecutive triples in
+  /// the same order as the fields above.
+  GCPointer<ArrayStorage> moreReactions_{nullptr};
+
+  State state_{State::Pending};
+
+  /// [[PromiseIsHandled]].
+  bool isHandled_{false};
+
+  /// Whether the inline reaction is set.
+  bool hasReaction_{false};
+};
+
+} // namespace vm
+} // namespace hermes
+
+#endif // HERMES_VM_JSPROMISE_H
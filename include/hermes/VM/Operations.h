@@ -406,6 +406,25 @@ CallResult<UncheckedIteratorRecord> getIterator(
     Handle<> obj,
     llvh::Optional<Handle<Callable>> method = llvh::None);
 
+/// ES2025 7.4.4 GetIteratorDirect
+/// \return the iterator record of \p obj, whose "next" method is not checked
+///   to be callable.
+CallResult<UncheckedIteratorRecord> getIteratorDirect(
+    Runtime &runtime,
+    Handle<JSObject> obj);
+
+/// How GetIteratorFlattenable treats primitive values.
+enum class PrimitiveHandling { IterateStringPrimitives, RejectPrimitives };
+
+/// ES2025 7.4.5 GetIteratorFlattenable
+/// \return the iterator of \p obj, or \p obj itself if it has no
+///   @@iterator method, as an iterator record whose "next" method is not
+///   checked to be callable.
+CallResult<UncheckedIteratorRecord> getIteratorFlattenable(
+    Runtime &runtime,
+    Handle<> obj,
+    PrimitiveHandling primitiveHandling);
+
 /// ES6.0 7.4.2
 CallResult<PseudoHandle<JSObject>> iteratorNext(
     Runtime &runtime,
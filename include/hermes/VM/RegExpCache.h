@@ -0,0 +1,103 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#ifndef HERMES_VM_REGEXPCACHE_H
+#define HERMES_VM_REGEXPCACHE_H
+
+#include "hermes/ADT/SimpleLRU.h"
+#include "hermes/Regex/RegexSupport.h"
+
+#include "llvh/ADT/ArrayRef.h"
+#include "llvh/ADT/DenseMap.h"
+#include "llvh/ADT/SmallVector.h"
+
+#include <cstdint>
+#include <deque>
+#include <vector>
+
+namespace hermes {
+namespace vm {
+
+/// A bounded cache of compiled regular expressions, keyed by the pattern and
+/// the syntax flags. RegExp objects constructed at runtime from a pattern that
+/// is already in the cache skip parsing and compiling it. The least recently
+/// used entry is evicted once the cache is full.
+class RegExpCache {
+ public:
+  /// Maximum number of compiled regular expressions kept in the cache.
+  static constexpr size_t kCapacity = 64;
+
+  /// Patterns longer than this many characters are never cached.
+  static constexpr size_t kMaxPatternLength = 1024;
+
+  /// A compiled regular expression.
+  struct Entry {
+    /// The syntax flags byte, followed by the pattern.
+    std::vector<char16_t> key{};
+    /// The regex bytecode.
+    std::vector<uint8_t> bytecode{};
+    /// The named groups, in the order they appear in the pattern.
+    std::deque<llvh::SmallVector<char16_t, 5>> orderedGroupNames{};
+    /// Maps each group name to its index. The keys point into
+    /// orderedGroupNames.
+    regex::ParsedGroupNamesMapping groupNamesMapping{};
+  };
+
+  RegExpCache() : lru_(kCapacity) {}
+
+  /// \return the entry for \p pattern compiled with \p flags, marking it as
+  ///   most recently used, or nullptr if there is none. Updates the hit and
+  ///   miss counters.
+  Entry *find(llvh::ArrayRef<char16_t> pattern, uint8_t flags);
+
+  /// Add the compiled \p bytecode of \p pattern with \p flags and its group
+  /// names to the cache, evicting the least recently used entry if the cache
+  /// is full. Patterns longer than kMaxPatternLength are ignored.
+  void insert(
+      llvh::ArrayRef<char16_t> pattern,
+      uint8_t flags,
+      std::vector<uint8_t> bytecode,
+      std::deque<llvh::SmallVector<char16_t, 5>> orderedGroupNames,
+      regex::ParsedGroupNamesMapping groupNamesMapping);
+
+  /// \return the number of lookups which found an entry.
+  uint64_t getNumHits() const {
+    return numHits_;
+  }
+
+  /// \return the number of lookups which did not find an entry.
+  uint64_t getNumMisses() const {
+    return numMisses_;
+  }
+
+  /// \return an estimate of the malloc memory used by the cache.
+  size_t getMallocSizeEstimate() const;
+
+ private:
+  /// Build the key of \p pattern with \p flags in keyBuf_.
+  llvh::ArrayRef<char16_t> makeKey(
+      llvh::ArrayRef<char16_t> pattern,
+      uint8_t flags);
+
+  /// The cached entries in least recently used order.
+  SimpleLRU<Entry> lru_;
+
+  /// Maps the key of each entry to the entry. The keys point into the
+  /// entries.
+  llvh::DenseMap<llvh::ArrayRef<char16_t>, Entry *> map_{};
+
+  /// Scratch storage for building keys to look up.
+  llvh::SmallVector<char16_t, 32> keyBuf_{};
+
+  uint64_t numHits_{0};
+  uint64_t numMisses_{0};
+};
+
+} // namespace vm
+} // namespace hermes
+
+#endif // HERMES_VM_REGEXPCACHE_H
@@ -29,7 +29,20 @@ void Runtime::registerBuiltin(
 }
 
 inline void Runtime::enqueueJob(Callable *job) {
-  jobQueue_.push_back(job);
+  jobQueue_.push_back(
+      Job{HermesValue::encodeObjectValue(job),
+          HermesValue::encodeUndefinedValue(),
+          HermesValue::encodeUndefinedValue(),
+          Job::Kind::Call});
+}
+
+inline void Runtime::enqueuePromiseJob(
+    Job::Kind kind,
+    HermesValue callee,
+    HermesValue argument,
+    HermesValue target) {
+  assert(kind != Job::Kind::Call && "Use enqueueJob for callables");
+  jobQueue_.push_back(Job{callee, argument, target, kind});
 }
 
 inline Handle<HiddenClass> Runtime::getHiddenClassForPrototype(
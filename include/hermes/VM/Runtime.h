@@ -35,6 +35,7 @@
 #include "hermes/VM/Profiler/SamplingProfilerDefs.h"
 #include "hermes/VM/PropertyCache.h"
 #include "hermes/VM/PropertyDescriptor.h"
+#include "hermes/VM/RegExpCache.h"
 #include "hermes/VM/RegExpMatch.h"
 #include "hermes/VM/RuntimeModule.h"
 #include "hermes/VM/StackFrame.h"
@@ -435,10 +436,43 @@ class Runtime : public RuntimeBase, public HandleRootOwner {
       BuiltinMethod::Enum builtinIndex,
       Callable *builtin);
 
+  /// A Job in \c jobQueue_.
+  struct Job {
+    enum class Kind : uint8_t {
+      /// Call \c callee with no arguments.
+      Call,
+      /// ES2024 27.2.2.1 NewPromiseReactionJob for a fulfilled promise: call
+      /// the handler \c callee, or pass through if it is undefined, with the
+      /// value \c argument and settle the capability \c target with the
+      /// result. See \c JSPromise for the representation of capabilities.
+      PromiseFulfill,
+      /// Same as \c PromiseFulfill, for a rejected promise with the reason
+      /// \c argument.
+      PromiseReject,
+      /// ES2024 27.2.2.2 NewPromiseResolveThenableJob: call \c callee, the
+      /// "then" method of the thenable \c argument, to resolve the promise
+      /// \c target.
+      PromiseResolveThenable,
+    };
+
+    PinnedHermesValue callee;
+    PinnedHermesValue argument;
+    PinnedHermesValue target;
+    Kind kind;
+  };
+
   /// ES6-ES11 8.4.1 EnqueueJob ( queueName, job, arguments )
   /// See \c jobQueue_ for how the Jobs and Job Queues are set up in Hermes.
   inline void enqueueJob(Callable *job);
 
+  /// Enqueue a Promise Job of kind \p kind with the given operands. Unlike
+  /// \c enqueueJob, this doesn't require a closure to be allocated.
+  inline void enqueuePromiseJob(
+      Job::Kind kind,
+      HermesValue callee,
+      HermesValue argument,
+      HermesValue target);
+
   /// ES6-ES11 8.6 RunJobs ( )
   /// Draining the job queue by invoking the queued jobs in FIFO order.
   ///
@@ -481,6 +515,10 @@ class Runtime : public RuntimeBase, public HandleRootOwner {
     return symbolRegistry_;
   }
 
+  RegExpCache &getRegExpCache() {
+    return regExpCache_;
+  }
+
   /// Return a StringPrimitive representation of a single character. The first
   /// 256 characters are pre-allocated. The rest are allocated every time.
   Handle<StringPrimitive> getCharacterString(char16_t ch);
@@ -712,6 +750,23 @@ class Runtime : public RuntimeBase, public HandleRootOwner {
     triggerAsyncBreak(AsyncBreakReasonBits::Timeout);
   }
 
+  /// Request the interpreter loop to yield to the callback set with
+  /// setYieldCallback() at the next AsyncBreakCheck. This may be called from
+  /// any thread, or a signal handler.
+  void triggerYieldAsyncBreak() {
+    triggerAsyncBreak(AsyncBreakReasonBits::Yield);
+  }
+
+  /// Set the callback invoked when the interpreter yields, replacing any
+  /// previous one. The callback runs on the thread executing JS, with the
+  /// interrupted frames still on the stack; execution resumes where it left
+  /// off once it returns. Returning EXCEPTION, with the thrown value set,
+  /// throws it from the yield point instead. Yield requests are ignored when
+  /// no callback is set.
+  void setYieldCallback(std::function<ExecutionStatus()> callback) {
+    yieldCallback_ = std::move(callback);
+  }
+
 #ifdef HERMES_ENABLE_DEBUGGER
   /// Encapsulates useful information about a stack frame, needed by the
   /// debugger. It requres extra context and cannot be extracted from a
@@ -1307,6 +1362,9 @@ class Runtime : public RuntimeBase, public HandleRootOwner {
   /// The global symbol registry.
   SymbolRegistry symbolRegistry_{};
 
+  /// Regular expressions compiled for RegExp objects created at runtime.
+  RegExpCache regExpCache_{};
+
   /// Shared location to place native objects required by JSLib
   std::unique_ptr<JSLibStorage> jsLibStorage_;
 
@@ -1381,7 +1439,7 @@ class Runtime : public RuntimeBase, public HandleRootOwner {
   bool builtinsFrozen_{false};
 
   /// ES6-ES11 8.4 Jobs and Job Queues.
-  /// A queue of pointers to callables that represent Jobs.
+  /// A queue of Jobs, most of which are callables.
   ///
   /// Job: Since the ScriptJob is removed from ES12, the only type of Job from
   /// ECMA-262 are Promise Jobs (https://tc39.es/ecma262/#sec-promise-jobs).
@@ -1394,13 +1452,17 @@ class Runtime : public RuntimeBase, public HandleRootOwner {
   /// the ES12 wording, Promise Jobs are Abstract Closure with no parameters).
   /// - `queueMicrotask` take a JSFunction but only invoke it with 0 arguments.
   ///
+  /// The Jobs of the native Promise implementation are instead stored as their
+  /// operands (see \c Job::Kind), so settling a promise or reacting to a
+  /// settled one doesn't allocate a thunk.
+  ///
   /// Although ES12 (9.4 Jobs and Host Operations to Enqueue Jobs) changed the
   /// meta-language to ask hosts to schedule Promise Job to integrate with the
   /// HTML spec, Hermes chose to adapt the ES6-11 suggested internal queue
   /// approach, similar to other engines, e.g. V8/JSC, which is more efficient
   /// (being able to batch the job invocations) and sufficient to express the
   /// HTML spec specified "perform a microtask checkpoint" algorithm.
-  std::deque<Callable *> jobQueue_{};
+  std::deque<Job> jobQueue_{};
 
 #ifdef HERMESVM_PROFILER_BB
   BasicBlockExecutionInfo basicBlockExecInfo_;
@@ -1437,6 +1499,7 @@ class Runtime : public RuntimeBase, public HandleRootOwner {
     DebuggerExplicit = 0x1,
     DebuggerImplicit = 0x2,
     Timeout = 0x4,
+    Yield = 0x8,
   };
 
   /// An atomic flag set when an async pause is requested.
@@ -1482,6 +1545,9 @@ class Runtime : public RuntimeBase, public HandleRootOwner {
   /// Config-provided callback for GC events.
   std::function<void(GCEventKind, const char *)> gcEventCallback_;
 
+  /// Callback invoked when the interpreter yields. See setYieldCallback().
+  std::function<ExecutionStatus()> yieldCallback_;
+
   /// @}
 
   /// \return whether any async break is requested or not.
@@ -1522,6 +1588,12 @@ class Runtime : public RuntimeBase, public HandleRootOwner {
         ;
   }
 
+  /// \return whether a yield async break was requested or not. Clear the yield
+  /// request bit afterward.
+  bool testAndClearYieldAsyncBreakRequest() {
+    return testAndClearAsyncBreakRequest((uint8_t)AsyncBreakReasonBits::Yield);
+  }
+
   /// Request the interpreter loop to take an asynchronous break
   /// at a convenient point.
   void triggerAsyncBreak(AsyncBreakReasonBits reason) {
@@ -1531,6 +1603,10 @@ class Runtime : public RuntimeBase, public HandleRootOwner {
   /// Notify runtime execution has timeout.
   ExecutionStatus notifyTimeout();
 
+  /// Notify runtime execution has been asked to yield, by calling the yield
+  /// callback if there is one.
+  ExecutionStatus notifyYield();
+
  private:
   /// See \c ::setCurrentIP() and \c ::getCurrentIP() .
   const inst::Inst *currentIP_{nullptr};
@@ -201,6 +201,26 @@ struct VMOnlyRuntimeFlags {
       llvh::cl::cat(GCCategory),
       llvh::cl::init(false)};
 
+  llvh::cl::opt<bool> GCHugePages{
+      "gc-huge-pages",
+      llvh::cl::desc(
+          "Back heap segments with huge pages where the OS supports them"),
+      llvh::cl::cat(GCCategory),
+      llvh::cl::init(false)};
+
+  llvh::cl::opt<bool> GCPrefaultSegments{
+      "gc-prefault-segments",
+      llvh::cl::desc(
+          "Fault in the pages of heap segments when they are allocated"),
+      llvh::cl::cat(GCCategory),
+      llvh::cl::init(false)};
+
+  llvh::cl::opt<unsigned> GCRetainedFreeSegments{
+      "gc-retained-free-segments",
+      llvh::cl::desc("Number of freed heap segments to keep mapped for reuse"),
+      llvh::cl::cat(GCCategory),
+      llvh::cl::init(0)};
+
   enum class JITMode {
     // JIT is ON with default thresholds.
     On,
@@ -8,6 +8,8 @@
 #ifndef HERMES_VM_STORAGEPROVIDER_H
 #define HERMES_VM_STORAGEPROVIDER_H
 
+#include "hermes/Public/GCConfig.h"
+
 #include "llvh/Support/ErrorOr.h"
 
 #include <limits>
@@ -21,16 +23,25 @@ namespace vm {
 class StorageProvider {
  public:
   StorageProvider() = default;
+  /// Back storage as requested by the AllowHugePages and PrefaultSegments
+  /// options of \p gcConfig.
+  explicit StorageProvider(const GCConfig &gcConfig);
   virtual ~StorageProvider();
 
   /// @name Factories
   /// @{
 
-  /// Provide storage from mmap'ed separate regions.
-  static std::unique_ptr<StorageProvider> mmapProvider();
+  /// Provide storage from mmap'ed separate regions. Up to
+  /// \p gcConfig.getRetainedFreeSegments() deleted storages of
+  /// AlignedHeapSegment::kSegmentUnitSize bytes are kept mapped and handed out
+  /// again by later requests.
+  static std::unique_ptr<StorageProvider> mmapProvider(
+      const GCConfig &gcConfig = GCConfig());
 
   /// Provide storage from a contiguous mmap'ed region.
-  static std::unique_ptr<StorageProvider> contiguousVAProvider(size_t size);
+  static std::unique_ptr<StorageProvider> contiguousVAProvider(
+      size_t size,
+      const GCConfig &gcConfig = GCConfig());
 
   /// Provide storage via malloc.
   static std::unique_ptr<StorageProvider> mallocProvider();
@@ -63,7 +74,31 @@ class StorageProvider {
   /// deleted yet.
   size_t numLiveAllocs() const;
 
+  /// The number of storages that were advised to be backed by huge pages.
+  size_t numHugePageAllocs() const;
+
+  /// The number of storages whose pages were faulted in when they were
+  /// allocated.
+  size_t numPrefaultedAllocs() const;
+
+  /// The number of page faults taken while pre-faulting storage. Without
+  /// pre-faulting, these would be taken on first touch by the mutator or the
+  /// GC instead.
+  int64_t numPrefaultPageFaults() const;
+
+  /// The number of storages handed out again from the retained free storage
+  /// instead of being mapped from the OS.
+  size_t numReusedAllocs() const;
+
  protected:
+  /// Apply the huge page and pre-fault options to the freshly mapped
+  /// \p storage of \p sz bytes. Implementations call this before handing out
+  /// storage that did not come from their retained free storage.
+  void prepareStorage(void *storage, size_t sz);
+
+  /// Record that a storage was handed out again from retained free storage.
+  void noteReusedStorage();
+
   /// \pre \p sz is non-zero and equal to a multiple of
   /// AlignedHeapSegment::kSegmentUnitSize.
   virtual llvh::ErrorOr<void *> newStorageImpl(size_t sz, const char *name) = 0;
@@ -72,9 +107,18 @@ class StorageProvider {
   virtual void deleteStorageImpl(void *storage, size_t sz) = 0;
 
  private:
+  /// Whether to advise the OS to back new storage with huge pages.
+  bool hugePages_{false};
+  /// Whether to fault in the pages of new storage up front.
+  bool prefault_{false};
+
   size_t numSucceededAllocs_{0};
   size_t numFailedAllocs_{0};
   size_t numDeletedAllocs_{0};
+  size_t numHugePageAllocs_{0};
+  size_t numPrefaultedAllocs_{0};
+  int64_t numPrefaultPageFaults_{0};
+  size_t numReusedAllocs_{0};
 };
 
 /// Attempts to allocate \p sz memory, aligned at \p alignment.
@@ -18,6 +18,7 @@
 
 #include "llvh/Support/TrailingObjects.h"
 
+#include <memory>
 #include <type_traits>
 
 namespace hermes {
@@ -217,6 +218,21 @@ class StringPrimitive : public VariableSizeRuntimeCell {
       Runtime &runtime,
       std::basic_string<char16_t> &&str);
 
+  /// Create an external StringPrimitive that references the characters of
+  /// \p str in place instead of copying them. The characters must remain
+  /// valid and unmodified until \p context is released, which happens when
+  /// the string is finalized by the GC. \p str must contain only 7-bit
+  /// characters.
+  static CallResult<HermesValue> createBorrowed(
+      Runtime &runtime,
+      ASCIIRef str,
+      std::shared_ptr<void> context);
+
+  static CallResult<HermesValue> createBorrowed(
+      Runtime &runtime,
+      UTF16Ref str,
+      std::shared_ptr<void> context);
+
   /// Like the above, but the created StringPrimitives will be
   /// allocated in a "long-lived" area of the heap (if the GC supports
   /// that concept).
@@ -578,6 +594,8 @@ class DynamicStringPrimitive final
 /// An immutable JavaScript primitive string consisting of length and a pointer
 /// to characters (either char or char16). The storage uses std::string or
 /// std::u16string, and the object's finalizer deallocates the storage.
+/// Alternatively the characters may be "borrowed" from the embedder, in which
+/// case the finalizer releases the context that keeps them alive.
 /// Note: while StringPrimitive extends VariableSizeRuntimeCell, these subtypes
 /// are not actually variable-sized: we indicate that they are fixed-size in the
 /// metadata.
@@ -621,7 +639,8 @@ class ExternalStringPrimitive final : public SymbolStringPrimitive {
   static const VTable vt;
 
   size_t calcExternalMemorySize() const {
-    return contents_.capacity() * sizeof(T);
+    // Borrowed characters are accounted for by their owner.
+    return borrowed_ ? 0 : contents_.capacity() * sizeof(T);
   }
 
  public:
@@ -630,9 +649,19 @@ class ExternalStringPrimitive final : public SymbolStringPrimitive {
   template <class BasicString>
   ExternalStringPrimitive(BasicString &&contents);
 
+  /// Construct an ExternalStringPrimitive referencing the embedder-owned
+  /// characters \p str, which are kept alive by \p context. Non-uniqued.
+  ExternalStringPrimitive(Ref str, std::shared_ptr<void> &&context);
+
+  /// \return true if the characters are borrowed rather than owned.
+  bool isBorrowed() const {
+    return borrowed_;
+  }
+
  private:
-  /// Destructor deallocates the contents_ string.
-  ~ExternalStringPrimitive() = default;
+  /// Destructor deallocates the contents_ string, or releases the context of
+  /// the borrowed characters.
+  ~ExternalStringPrimitive();
 
   /// Transfer ownership of an std::string into a new StringPrim. Throw \c
   /// RangeError if the string is longer than \c MAX_STRING_LENGTH characters.
@@ -653,7 +682,16 @@ class ExternalStringPrimitive final : public SymbolStringPrimitive {
   /// \c CallResult<HermesValue>. This should only be used by StringBuilder.
   static CallResult<HermesValue> create(Runtime &runtime, uint32_t length);
 
+  /// Create a StringPrim referencing the embedder-owned characters \p str
+  /// without copying them. \p context is released when the string is
+  /// finalized. Throw \c RangeError if the string is longer than
+  /// \c MAX_STRING_LENGTH characters.
+  static CallResult<HermesValue>
+  createBorrowed(Runtime &runtime, Ref str, std::shared_ptr<void> &&context);
+
   const T *getRawPointer() const {
+    if (LLVM_UNLIKELY(borrowed_))
+      return borrowedStorage_.data;
     // C++11 defines this to be valid even if the string is empty.
     return &contents_[0];
   }
@@ -663,6 +701,7 @@ class ExternalStringPrimitive final : public SymbolStringPrimitive {
   /// normally be done, but for those rare cases, this method gives access to
   /// the writable buffer.
   T *getRawPointerForWrite() {
+    assert(!borrowed_ && "borrowed strings are immutable");
     // C++11 defines this to be valid even if the string is empty.
     return &contents_[0];
   }
@@ -679,9 +718,25 @@ class ExternalStringPrimitive final : public SymbolStringPrimitive {
   static void _snapshotAddNodesImpl(GCCell *cell, GC &gc, HeapSnapshot &snap);
 #endif
 
-  /// The backing storage of this string. Note that the string's length is fixed
-  /// and must always be equal to StringPrimitive::getStringLength().
-  CopyableStdString contents_{};
+  /// Characters owned by the embedder, together with the context that keeps
+  /// them alive. Neither member contains interior pointers, so this is safe
+  /// to memcpy() by the GC regardless of the length of the string.
+  struct BorrowedStorage {
+    const T *data;
+    std::shared_ptr<void> context;
+  };
+
+  /// Whether borrowedStorage_ (rather than contents_) is the active member of
+  /// the union below.
+  bool borrowed_;
+
+  union {
+    /// The backing storage of this string. Note that the string's length is
+    /// fixed and must always be equal to StringPrimitive::getStringLength().
+    CopyableStdString contents_;
+    /// The backing storage of a borrowed string.
+    BorrowedStorage borrowedStorage_;
+  };
 };
 
 /// An immutable JavaScript primitive consisting of a pointer to an
@@ -755,6 +810,9 @@ class BufferedStringPrimitive final : public StringPrimitive {
       Handle<ExternalStringPrimitive<T>> concatBuffer)
       : StringPrimitive(length) {
     concatBufferHV_.set(concatBuffer.getHermesValue(), runtime.getHeap());
+    assert(
+        !concatBuffer->isBorrowed() &&
+        "borrowed strings cannot be used as concatenation buffers");
     assert(
         concatBuffer->contents_.size() >= length &&
         "length exceeds size of concatenation buffer");
@@ -26,6 +26,8 @@ class Runtime;
 /// an async break request which an AsyncBreakCheck instruction will check and
 /// perform corresponding action (e.g., terminate execution, if the monitor is
 /// being used to prevent infinite executions...).
+/// It also time-slices runtimes, by periodically requesting them to yield to
+/// their host.
 class TimeLimitMonitor {
  public:
   using Deadline = std::chrono::steady_clock::time_point;
@@ -43,6 +45,14 @@ class TimeLimitMonitor {
   /// Stops watching \p runtime for timeouts.
   void unwatchRuntime(Runtime &runtime);
 
+  /// Requests \p runtime to yield every \p slice (ms), until
+  /// unwatchRuntimeTimeSlice() is called. This replaces the current time
+  /// slice of \p runtime, if any.
+  void watchRuntimeTimeSlice(Runtime &runtime, std::chrono::milliseconds slice);
+
+  /// Stops requesting \p runtime to yield.
+  void unwatchRuntimeTimeSlice(Runtime &runtime);
+
   /// Returns the map of currently-watched runtimes. Mostly for testing.
   const llvh::DenseMap<Runtime *, Deadline> &getWatchedRuntimes() const {
     return watchedRuntimes_;
@@ -67,6 +77,15 @@ class TimeLimitMonitor {
   /// Maps all Runtimes being watched to their respective deadlines.
   llvh::DenseMap<Runtime *, Deadline> watchedRuntimes_;
 
+  /// The time slice of a runtime, and the end of its current slice.
+  struct TimeSlice {
+    std::chrono::milliseconds slice;
+    Deadline end;
+  };
+
+  /// Maps all Runtimes being time-sliced to their time slices.
+  llvh::DenseMap<Runtime *, TimeSlice> timeSlicedRuntimes_;
+
   /// Flag indicating whether the TimeLimitMonitor is enabled or not. Set to
   /// false during destruction to stop the timerLoop thread.
   bool enabled_{true};
@@ -56,6 +56,7 @@
 
 #include "zip/src/zip.h"
 
+#include <chrono>
 #include <sstream>
 
 #define DEBUG_TYPE "hermes"
@@ -467,16 +468,12 @@ static opt<bool> Colors(
     desc("Use colors in some dumps"),
     cat(CompilerCategory));
 
-#ifndef NDEBUG
-
 static opt<bool> LexerOnly(
     "Xlexer-only",
-    desc("Only run the lexer on the input (debug builds only)"),
+    desc("Only run the lexer on the input and report its throughput"),
     Hidden,
     cat(CompilerCategory));
 
-#endif
-
 static opt<int> MaxDiagnosticWidth(
     "max-diagnostic-width",
     llvh::cl::desc("Preferred diagnostic maximum width"),
@@ -1931,11 +1928,13 @@ CompileResult processSourceFiles(
   assert(
       rawFinalHash.size() == SHA1_NUM_BYTES && "Incorrect length of SHA1 hash");
   std::copy(rawFinalHash.begin(), rawFinalHash.end(), sourceHash.begin());
-#ifndef NDEBUG
   if (cl::LexerOnly) {
     unsigned count = 0;
+    size_t bytes = 0;
+    auto start = std::chrono::steady_clock::now();
     for (auto &entry : fileBufs) {
       for (auto &fileAndMap : entry.second) {
+        bytes += fileAndMap.file->getBufferSize();
         parser::JSLexer jsLexer(
             std::move(fileAndMap.file),
             context->getSourceErrorManager(),
@@ -1944,10 +1943,13 @@ CompileResult processSourceFiles(
           ++count;
       }
     }
+    auto usec = std::chrono::duration_cast<std::chrono::microseconds>(
+                    std::chrono::steady_clock::now() - start)
+                    .count();
     llvh::outs() << count << " tokens lexed\n";
+    llvh::outs() << bytes << " bytes in " << usec << " us\n";
     return Success;
   }
-#endif
 
   // A list of parsed global definition files.
   DeclarationFileListTy declFileList;
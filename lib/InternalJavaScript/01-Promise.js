@@ -421,12 +421,6 @@
     });
   };
 
-  var DEFAULT_WHITELIST = [
-    ReferenceError,
-    TypeError,
-    RangeError
-  ];
-
   var enabled = false;
   var disable_1 = disable;
   function disable() {
@@ -464,13 +458,7 @@
           error: err,
           timeout: setTimeout(
             onUnhandled.bind(null, promise._E),
-            // For reference errors and type errors, this almost always
-            // means the programmer made a mistake, so log them after just
-            // 100ms
-            // otherwise, wait 2 seconds to see if they get handled
-            matchWhitelist(err, DEFAULT_WHITELIST)
-              ? 100
-              : 2000
+            unhandledRejectionDelay(err)
           ),
           logged: false
         };
@@ -481,7 +469,7 @@
         options.allRejections ||
         matchWhitelist(
           rejections[id].error,
-          options.whitelist || DEFAULT_WHITELIST
+          options.whitelist || DEFAULT_REJECTION_WHITELIST
         )
       ) {
         rejections[id].displayId = displayId++;
@@ -505,32 +493,12 @@
         if (options.onHandled) {
           options.onHandled(rejections[id].displayId, rejections[id].error);
         } else if (!rejections[id].onUnhandled) {
-          console.warn(
-            'Promise Rejection Handled (id: ' + rejections[id].displayId + '):'
-          );
-          console.warn(
-            '  This means you can ignore any previous messages of the form "Possible Unhandled Promise Rejection" with id ' +
-            rejections[id].displayId + '.'
-          );
+          logHandled(rejections[id].displayId);
         }
       }
     }
   }
 
-  function logError(id, error) {
-    console.warn('Possible Unhandled Promise Rejection (id: ' + id + '):');
-    var errStr = (error && (error.stack || error)) + '';
-    errStr.split('\n').forEach(function (line) {
-      console.warn('  ' + line);
-    });
-  }
-
-  function matchWhitelist(error, list) {
-    return list.some(function (cls) {
-      return error instanceof cls;
-    });
-  }
-
   var rejectionTracking = {
   	disable: disable_1,
   	enable: enable_1
@@ -559,4 +527,120 @@
   return promise;
 
 });
-initPromise();
+
+// Rejection tracking helpers shared by the polyfill above and by the tracker
+// of the native Promise below.
+
+// Rejections of these types are reported by default.
+var DEFAULT_REJECTION_WHITELIST = [
+  ReferenceError,
+  TypeError,
+  RangeError
+];
+
+function matchWhitelist(error, list) {
+  return list.some(function (cls) {
+    return error instanceof cls;
+  });
+}
+
+// For reference errors and type errors, this almost always means the
+// programmer made a mistake, so log them after just 100ms. Otherwise, wait 2
+// seconds to see if they get handled.
+function unhandledRejectionDelay(error) {
+  return matchWhitelist(error, DEFAULT_REJECTION_WHITELIST) ? 100 : 2000;
+}
+
+function logError(id, error) {
+  console.warn('Possible Unhandled Promise Rejection (id: ' + id + '):');
+  var errStr = (error && (error.stack || error)) + '';
+  errStr.split('\n').forEach(function (line) {
+    console.warn('  ' + line);
+  });
+}
+
+function logHandled(id) {
+  console.warn('Promise Rejection Handled (id: ' + id + '):');
+  console.warn(
+    '  This means you can ignore any previous messages of the form "Possible Unhandled Promise Rejection" with id ' +
+    id + '.'
+  );
+}
+
+// When the microtask queue is enabled, the engine provides a native Promise,
+// which calls the tracker registered here (with the `enable` function) for
+// each rejection without a handler, and when such a rejection gets handled.
+// This mirrors the rejection tracking of the polyfill above.
+function initNativePromiseRejectionTracking() {
+  var HermesWeakMap = WeakMap;
+
+  var options = null;
+  var displayId = 0;
+  var rejections = new HermesWeakMap();
+
+  function enable(opts) {
+    options = opts || {};
+    rejections = new HermesWeakMap();
+  }
+
+  function track(promise, reason, handled) {
+    if (!options) return;
+    var rejection;
+    if (handled) {
+      rejection = rejections.get(promise);
+      if (!rejection) return;
+      rejections.delete(promise);
+      if (rejection.logged) {
+        onHandled(rejection);
+      } else {
+        clearTimeout(rejection.timeout);
+      }
+      return;
+    }
+    rejection = {
+      displayId: null,
+      error: reason,
+      timeout: null,
+      logged: false
+    };
+    rejection.timeout = setTimeout(
+      onUnhandled.bind(null, options, rejection),
+      unhandledRejectionDelay(reason)
+    );
+    rejections.set(promise, rejection);
+  }
+
+  function onUnhandled(options, rejection) {
+    if (
+      options.allRejections ||
+      matchWhitelist(
+        rejection.error,
+        options.whitelist || DEFAULT_REJECTION_WHITELIST
+      )
+    ) {
+      rejection.displayId = displayId++;
+      rejection.logged = true;
+      if (options.onUnhandled) {
+        options.onUnhandled(rejection.displayId, rejection.error);
+      } else {
+        logError(rejection.displayId, rejection.error);
+      }
+    }
+  }
+
+  function onHandled(rejection) {
+    if (options.onHandled) {
+      options.onHandled(rejection.displayId, rejection.error);
+    } else {
+      logHandled(rejection.displayId);
+    }
+  }
+
+  HermesInternal?.setPromiseRejectionTrackingHook?.(enable, track);
+}
+
+if (typeof globalThis.Promise === 'function') {
+  initNativePromiseRejectionTracking();
+} else {
+  initPromise();
+}
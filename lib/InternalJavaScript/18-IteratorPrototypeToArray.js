@@ -1,61 +0,0 @@
-/* @nolint */
-/**
- * MIT License
- * Portions Copyright (c) Meta Platforms, Inc. and affiliates.
- * Copyright (c) 2022 ECMAScript Shims
- *
- * Permission is hereby granted, free of charge, to any person obtaining a copy
- * of this software and associated documentation files (the "Software"), to deal
- * in the Software without restriction, including without limitation the rights
- * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
- * copies of the Software, and to permit persons to whom the Software is
- * furnished to do so, subject to the following conditions:
- *
- * The above copyright notice and this permission notice shall be included in all
- * copies or substantial portions of the Software.
- *
- * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
- * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
- * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
- * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
- * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
- * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
- * SOFTWARE.
- */
-
-// ==========================
-// Iterator.prototype.toArray Implementation
-// Adapted from https://github.com/es-shims/iterator-helpers/tree/main/Iterator.prototype.toArray at fbd6ffe (v1.2.2)
-// ==========================
-
-// From es-iterator-helpers/Iterator.prototype.toArray/implementation.js
-var IteratorPrototypeToArray = function toArray() {
-	if (new.target !== undefined) {
-		throw new TypeError('`toArray` is not a constructor');
-	}
-
-	var O = this; // step 1
-
-	if (!isObject(O)) {
-		throw new TypeError('`this` value must be an Object'); // step 2
-	}
-
-	var iterated = GetIteratorDirect(O); // step 3
-
-	var items = []; // step 4
-
-	// eslint-disable-next-line no-constant-condition
-	while (true) { // step 5
-		var value = IteratorStepValue(iterated); // step 5.a
-		if (iterated['[[Done]]']) {
-			return items; // step 5.b
-		}
-		items[items.length] = value; // step 5.d
-	}
-};
-
-defineProperties(
-	Iterator.prototype,
-	{ toArray: IteratorPrototypeToArray },
-	{ toArray: function () { return Iterator.prototype.toArray !== IteratorPrototypeToArray; } }
-);
@@ -11,6 +11,7 @@
 #include "dtoa/dtoa.h"
 #include "hermes/Support/Conversions.h"
 
+#include "hermes/Support/FastCharScan.h"
 #include "hermes/Support/FastStrToDouble.h"
 #include "llvh/ADT/ScopeExit.h"
 #include "llvh/ADT/StringSwitch.h"
@@ -514,10 +515,9 @@ const Token *JSLexer::advance(GrammarContext grammarContext) {
 
       case '\t':
       case ' ':
-        // Spaces frequently come in groups, so use a tight inner loop to skip.
-        do
-          ++curCharPtr_;
-        while (*curCharPtr_ == '\t' || *curCharPtr_ == ' ');
+        // Spaces frequently come in groups (e.g. indentation), so skip the
+        // whole run at once.
+        curCharPtr_ = skipSpacesAndTabs(curCharPtr_ + 1, bufferEnd_);
         continue;
 
       // No-break space \u00A0 is UTF8 encoded as: c2 a0
@@ -960,10 +960,8 @@ bool JSLexer::isCurrentTokenADirective() {
 
       case '\t':
       case ' ':
-        // Spaces frequently come in groups, so use a tight inner loop to skip.
-        do
-          ++ptr;
-        while (*ptr == '\t' || *ptr == ' ');
+        // Spaces frequently come in groups, so skip the whole run at once.
+        ptr = skipSpacesAndTabs(ptr + 1, bufferEnd_);
         continue;
 
       // No-break space \u00A0 is UTF8 encoded as: c2 a0
@@ -1472,7 +1470,7 @@ llvh::StringRef JSLexer::lineCommentHelper(const char *start) {
         if (LLVM_UNLIKELY(isUTF8Start(*cur)))
           _decodeUTF8SlowPath(cur);
         else
-          ++cur;
+          cur = scanUntilSpecialChar(cur + 1, bufferEnd_, '\n', '\n');
         break;
     }
   }
@@ -1558,7 +1556,7 @@ const char *JSLexer::skipBlockComment(const char *start) {
         if (LLVM_UNLIKELY(isUTF8Start(*cur)))
           _decodeUTF8SlowPath(cur);
         else
-          ++cur;
+          cur = scanUntilSpecialChar(cur + 1, bufferEnd_, '*', '*');
         break;
     }
   }
@@ -1893,14 +1891,13 @@ template <JSLexer::IdentifierMode Mode>
 void JSLexer::scanIdentifierFastPath(const char *start) {
   const char *end = start;
 
-  // Quickly consume the ASCII identifier part.
-  char ch;
-  do
-    ch = (unsigned char)*++end;
-  while (ch == '_' || ch == '$' || ((ch | 32) >= 'a' && (ch | 32) <= 'z') ||
-         (ch >= '0' && ch <= '9') ||
-         (Mode == IdentifierMode::JSX && ch == '-') ||
-         (Mode == IdentifierMode::Flow && ch == '@'));
+  // Quickly consume the ASCII identifier part. The extra identifier
+  // character defaults to '_', which is already accepted.
+  constexpr char extra = Mode == IdentifierMode::JSX ? '-'
+      : Mode == IdentifierMode::Flow                 ? '@'
+                                                     : '_';
+  end = scanASCIIIdentifierChars(end + 1, bufferEnd_, extra);
+  char ch = *end;
 
   // Check whether a slow part of the identifier follows.
   if (LLVM_UNLIKELY(ch == '\\')) {
@@ -2120,7 +2117,12 @@ void JSLexer::scanString() {
         // storage
         appendUnicodeToStorage(_decodeUTF8SlowPath(curCharPtr_));
       } else {
-        tmpStorage_.push_back(*curCharPtr_++);
+        // Append the whole run of characters that need no special handling.
+        // The current character is one of them, so we always make progress.
+        const char *runEnd = scanUntilSpecialChar(
+            curCharPtr_ + 1, bufferEnd_, quoteCh, JSX ? '&' : '\\');
+        tmpStorage_.append(curCharPtr_, runEnd);
+        curCharPtr_ = runEnd;
       }
     }
   }
@@ -7,6 +7,8 @@
 
 #include "hermes/SourceMap/SourceMap.h"
 
+#include "hermes/SourceMap/SourceMapIndex.h"
+
 #include "llvh/Support/Path.h"
 
 #include <algorithm>
@@ -24,6 +26,27 @@ SourceMap::SourceMap(
       sources_(std::move(sources)),
       lines_(std::move(lines)),
       sourcesMetadata_(std::move(sourcesMetadata)) {
+  initRootedSources();
+}
+
+SourceMap::SourceMap(
+    llvh::StringRef sourceRoot,
+    llvh::StringRef originalSourceRoot,
+    std::vector<std::string> &&sources,
+    std::unique_ptr<SourceMapIndex> index,
+    MetadataList &&sourcesMetadata)
+    : sourceRoot_(sourceRoot),
+      originalSourceRoot_(originalSourceRoot),
+      sources_(std::move(sources)),
+      index_(std::move(index)),
+      sourcesMetadata_(std::move(sourcesMetadata)) {
+  assert(index_ && "a lazy source map needs an index");
+  initRootedSources();
+}
+
+SourceMap::~SourceMap() = default;
+
+void SourceMap::initRootedSources() {
   // Prepend sourceRoot_ to sources_ if it is not empty.
   // Make sure to leave absolute paths alone.
   if (!sourceRoot_.empty()) {
@@ -78,9 +101,20 @@ llvh::Optional<SourceMapTextLocation> SourceMap::getLocationForAddress(
       getSourceFullPath(loc->fileIndex), loc->line, loc->column};
 }
 
+bool SourceMap::writeIndex(llvh::raw_ostream &OS) const {
+  if (!index_) {
+    return false;
+  }
+  index_->write(OS, originalSourceRoot_, sources_);
+  return true;
+}
+
 llvh::Optional<SourceMap::Segment> SourceMap::getSegmentForAddress(
     uint32_t line,
     uint32_t column) const {
+  if (index_) {
+    return index_->getSegmentForAddress(line, column);
+  }
   if (line == 0 || line > lines_.size()) {
     return llvh::None;
   }
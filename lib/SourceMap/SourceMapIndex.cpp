@@ -0,0 +1,356 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include "hermes/SourceMap/SourceMapIndex.h"
+
+#include "hermes/SourceMap/SourceMapParser.h"
+
+#include "llvh/Support/raw_ostream.h"
+
+#include <algorithm>
+#include <cstring>
+
+using llvh::support::ulittle32_t;
+
+namespace hermes {
+
+namespace {
+
+/// "HSMI" in little endian, at the start of every serialized index.
+constexpr uint32_t kIndexMagic = 0x494d5348;
+
+/// Version of the serialized format.
+constexpr uint32_t kIndexVersion = 1;
+
+/// Header of a serialized index. It is followed by:
+///   ulittle32_t sourceEnds[numSources]  (end offsets into the strings)
+///   ulittle32_t lineStarts[numLines + 1]
+///   Checkpoint checkpoints[numCheckpoints]
+///   char sourceRoot[sourceRootSize]
+///   char strings[stringsSize]  (the concatenated source paths)
+///   char mappings[mappingsSize]
+struct IndexHeader {
+  ulittle32_t magic;
+  ulittle32_t version;
+  ulittle32_t numSources;
+  ulittle32_t numLines;
+  ulittle32_t numCheckpoints;
+  ulittle32_t sourceRootSize;
+  ulittle32_t stringsSize;
+  ulittle32_t mappingsSize;
+};
+
+/// Find the end of the segment starting at \p offset in \p mappings.
+/// \return the offset of the terminating ',' or ';', or the size of
+///   \p mappings, and set \p lastInLine if the segment ends a line.
+size_t
+findSegmentEnd(llvh::StringRef mappings, size_t offset, bool &lastInLine) {
+  size_t end = mappings.find_first_of(",;", offset);
+  if (end == llvh::StringRef::npos) {
+    end = mappings.size();
+  }
+  lastInLine = end == mappings.size() || mappings[end] == ';';
+  return end;
+}
+
+} // namespace
+
+std::unique_ptr<SourceMapIndex> SourceMapIndex::build(std::string mappings) {
+  if (mappings.size() > UINT32_MAX) {
+    return nullptr;
+  }
+  std::unique_ptr<SourceMapIndex> index{new SourceMapIndex()};
+  index->ownedMappings_ = std::move(mappings);
+  llvh::StringRef str = index->ownedMappings_;
+  auto &lineStarts = index->ownedLineStarts_;
+  auto &checkpoints = index->ownedCheckpoints_;
+
+  // This follows SourceMapParser::parseMappings(), but only records the
+  // decoder state at the start of every block.
+  SourceMapParser::State state;
+  uint32_t segmentsInLine = 0;
+  lineStarts.emplace_back(0);
+  size_t curSegOffset = 0;
+  while (curSegOffset < str.size()) {
+    bool lastSegmentInLine;
+    size_t endSegOffset = findSegmentEnd(str, curSegOffset, lastSegmentInLine);
+    const char *pCur = str.data() + curSegOffset;
+    const char *pSegEnd = str.data() + endSegOffset;
+
+    if (pCur == pSegEnd && lastSegmentInLine && segmentsInLine == 0) {
+      // The line is empty.
+      lineStarts.emplace_back(checkpoints.size());
+    } else {
+      bool startsBlock = segmentsInLine % kSegmentsPerBlock == 0;
+      if (startsBlock) {
+        Checkpoint cp;
+        cp.offset = curSegOffset;
+        cp.firstColumn = 0;
+        cp.generatedColumn = state.generatedColumn;
+        cp.sourceIndex = state.sourceIndex;
+        cp.representedLine = state.representedLine;
+        cp.representedColumn = state.representedColumn;
+        cp.nameIndex = state.nameIndex;
+        checkpoints.push_back(cp);
+      }
+
+      llvh::Optional<SourceMap::Segment> segmentOpt =
+          SourceMapParser::parseSegment(state, pCur, pSegEnd);
+      if (!segmentOpt.hasValue()) {
+        return nullptr;
+      }
+      if (startsBlock) {
+        checkpoints.back().firstColumn = segmentOpt->generatedColumn;
+      }
+      SourceMapParser::updateState(state, *segmentOpt);
+      ++segmentsInLine;
+
+      if (lastSegmentInLine) {
+        // generated column should be reset for new line.
+        state.generatedColumn = 0;
+        segmentsInLine = 0;
+        lineStarts.emplace_back(checkpoints.size());
+      }
+    }
+    curSegOffset = endSegOffset + 1;
+  }
+
+  index->mappings_ = str;
+  index->lineStarts_ = lineStarts;
+  index->checkpoints_ = checkpoints;
+  return index;
+}
+
+bool SourceMapIndex::isSerialized(llvh::StringRef data) {
+  return data.size() >= sizeof(IndexHeader) &&
+      reinterpret_cast<const IndexHeader *>(data.data())->magic == kIndexMagic;
+}
+
+std::unique_ptr<SourceMapIndex> SourceMapIndex::read(
+    std::unique_ptr<llvh::MemoryBuffer> buffer,
+    std::string &sourceRoot,
+    std::vector<std::string> &sources,
+    std::string &error) {
+  llvh::StringRef data = buffer->getBuffer();
+  if (!isSerialized(data)) {
+    error = "Not a source map index";
+    return nullptr;
+  }
+  const auto *header = reinterpret_cast<const IndexHeader *>(data.data());
+  if (header->version != kIndexVersion) {
+    error = "Unsupported source map index version " +
+        std::to_string(header->version);
+    return nullptr;
+  }
+
+  uint32_t numSources = header->numSources;
+  uint32_t numLines = header->numLines;
+  uint32_t numCheckpoints = header->numCheckpoints;
+  uint32_t sourceRootSize = header->sourceRootSize;
+  uint32_t stringsSize = header->stringsSize;
+  uint32_t mappingsSize = header->mappingsSize;
+  uint64_t expectedSize = sizeof(IndexHeader) +
+      sizeof(ulittle32_t) * ((uint64_t)numSources + numLines + 1) +
+      sizeof(Checkpoint) * (uint64_t)numCheckpoints + sourceRootSize +
+      stringsSize + mappingsSize;
+  if (data.size() != expectedSize) {
+    error = "Source map index has the wrong size";
+    return nullptr;
+  }
+
+  const char *p = data.data() + sizeof(IndexHeader);
+  llvh::ArrayRef<ulittle32_t> sourceEnds{
+      reinterpret_cast<const ulittle32_t *>(p), numSources};
+  p += sizeof(ulittle32_t) * numSources;
+  llvh::ArrayRef<ulittle32_t> lineStarts{
+      reinterpret_cast<const ulittle32_t *>(p), (size_t)numLines + 1};
+  p += sizeof(ulittle32_t) * ((size_t)numLines + 1);
+  llvh::ArrayRef<Checkpoint> checkpoints{
+      reinterpret_cast<const Checkpoint *>(p), numCheckpoints};
+  p += sizeof(Checkpoint) * numCheckpoints;
+  llvh::StringRef root{p, sourceRootSize};
+  p += sourceRootSize;
+  llvh::StringRef strings{p, stringsSize};
+  p += stringsSize;
+  llvh::StringRef mappings{p, mappingsSize};
+
+  // Validate everything that queries rely on, so that a corrupt index cannot
+  // cause out of bounds accesses later.
+  uint32_t prev = 0;
+  for (uint32_t end : sourceEnds) {
+    if (end < prev || end > stringsSize) {
+      error = "Source map index has invalid source paths";
+      return nullptr;
+    }
+    prev = end;
+  }
+  prev = 0;
+  for (uint32_t start : lineStarts) {
+    if (start < prev || start > numCheckpoints) {
+      error = "Source map index has invalid lines";
+      return nullptr;
+    }
+    prev = start;
+  }
+  if (lineStarts.front() != 0 || lineStarts.back() != numCheckpoints) {
+    error = "Source map index has invalid lines";
+    return nullptr;
+  }
+  for (const Checkpoint &cp : checkpoints) {
+    if (cp.offset >= mappingsSize) {
+      error = "Source map index has invalid mappings";
+      return nullptr;
+    }
+  }
+
+  sourceRoot = root.str();
+  sources.clear();
+  sources.reserve(numSources);
+  prev = 0;
+  for (uint32_t end : sourceEnds) {
+    sources.push_back(strings.slice(prev, end).str());
+    prev = end;
+  }
+
+  std::unique_ptr<SourceMapIndex> index{new SourceMapIndex()};
+  index->buffer_ = std::move(buffer);
+  index->mappings_ = mappings;
+  index->lineStarts_ = lineStarts;
+  index->checkpoints_ = checkpoints;
+  return index;
+}
+
+void SourceMapIndex::write(
+    llvh::raw_ostream &OS,
+    llvh::StringRef sourceRoot,
+    llvh::ArrayRef<std::string> sources) const {
+  std::string strings;
+  std::vector<ulittle32_t> sourceEnds;
+  sourceEnds.reserve(sources.size());
+  for (const std::string &source : sources) {
+    strings += source;
+    sourceEnds.emplace_back(strings.size());
+  }
+
+  IndexHeader header;
+  header.magic = kIndexMagic;
+  header.version = kIndexVersion;
+  header.numSources = sources.size();
+  header.numLines = getNumLines();
+  header.numCheckpoints = checkpoints_.size();
+  header.sourceRootSize = sourceRoot.size();
+  header.stringsSize = strings.size();
+  header.mappingsSize = mappings_.size();
+
+  auto writeArray = [&OS](const void *data, size_t size) {
+    OS.write(reinterpret_cast<const char *>(data), size);
+  };
+  writeArray(&header, sizeof(header));
+  writeArray(sourceEnds.data(), sizeof(ulittle32_t) * sourceEnds.size());
+  writeArray(lineStarts_.data(), sizeof(ulittle32_t) * lineStarts_.size());
+  writeArray(checkpoints_.data(), sizeof(Checkpoint) * checkpoints_.size());
+  OS << sourceRoot << strings << mappings_;
+}
+
+llvh::Optional<SourceMap::Segment> SourceMapIndex::getSegmentForAddress(
+    uint32_t line,
+    uint32_t column) const {
+  if (line == 0 || line > getNumLines()) {
+    return llvh::None;
+  }
+
+  // line is 1-based.
+  const Checkpoint *first = checkpoints_.begin() + lineStarts_[line - 1];
+  const Checkpoint *last = checkpoints_.begin() + lineStarts_[line];
+  if (first == last) {
+    return llvh::None;
+  }
+  assert(column >= 1 && "the column argument to this function is 1-based");
+  uint32_t columnIndex = column - 1;
+  // Find the last block that starts at or before the column, exactly like
+  // SourceMap::getSegmentForAddress() does for segments.
+  const Checkpoint *cp = std::upper_bound(
+      first, last, columnIndex, [](uint32_t column, const Checkpoint &cp) {
+        return column < (uint32_t)(int32_t)cp.firstColumn;
+      });
+  if (cp == first) {
+    return llvh::None;
+  }
+  uint32_t block = (cp - 1) - checkpoints_.begin();
+
+  std::lock_guard<std::mutex> lock{cacheMutex_};
+  const SourceMap::SegmentList &segments = getBlock(block);
+  auto segIter = std::upper_bound(
+      segments.begin(),
+      segments.end(),
+      columnIndex,
+      [](uint32_t column, const SourceMap::Segment &seg) {
+        return column < (uint32_t)seg.generatedColumn;
+      });
+  if (segIter == segments.begin()) {
+    // Only possible if the mappings do not match the index.
+    return llvh::None;
+  }
+  return *(segIter - 1);
+}
+
+void SourceMapIndex::decodeBlock(
+    uint32_t block,
+    SourceMap::SegmentList &segments) const {
+  const Checkpoint &cp = checkpoints_[block];
+  SourceMapParser::State state;
+  state.generatedColumn = cp.generatedColumn;
+  state.sourceIndex = cp.sourceIndex;
+  state.representedLine = cp.representedLine;
+  state.representedColumn = cp.representedColumn;
+  state.nameIndex = cp.nameIndex;
+
+  segments.clear();
+  size_t curSegOffset = cp.offset;
+  while (segments.size() < kSegmentsPerBlock &&
+         curSegOffset < mappings_.size()) {
+    bool lastSegmentInLine;
+    size_t endSegOffset =
+        findSegmentEnd(mappings_, curSegOffset, lastSegmentInLine);
+    const char *pCur = mappings_.data() + curSegOffset;
+    llvh::Optional<SourceMap::Segment> segmentOpt =
+        SourceMapParser::parseSegment(
+            state, pCur, mappings_.data() + endSegOffset);
+    if (!segmentOpt.hasValue()) {
+      // The mappings were validated when the index was built, but a
+      // deserialized index may not match its mappings.
+      break;
+    }
+    SourceMapParser::updateState(state, *segmentOpt);
+    segments.push_back(*segmentOpt);
+    if (lastSegmentInLine) {
+      break;
+    }
+    curSegOffset = endSegOffset + 1;
+  }
+}
+
+const SourceMap::SegmentList &SourceMapIndex::getBlock(uint32_t block) const {
+  auto it = cached_.find(block);
+  if (it != cached_.end()) {
+    lru_.use(it->second);
+    return it->second->segments;
+  }
+
+  if (cached_.size() >= kCachedBlocks) {
+    CachedBlock *evicted = lru_.leastRecent();
+    cached_.erase(evicted->block);
+    lru_.remove(evicted);
+  }
+  // The entry may reuse the storage of an evicted one.
+  CachedBlock *entry = lru_.add(CachedBlock{block, {}});
+  cached_[block] = entry;
+  decodeBlock(block, entry->segments);
+  return entry->segments;
+}
+
+} // namespace hermes
@@ -8,6 +8,7 @@
 #include "hermes/SourceMap/SourceMapParser.h"
 
 #include "hermes/Parser/JSONParser.h"
+#include "hermes/SourceMap/SourceMapIndex.h"
 #include "hermes/Support/Base64vlq.h"
 
 #include <algorithm>
@@ -19,10 +20,34 @@ using namespace hermes::parser;
 
 namespace hermes {
 
+/// \return \p sourceRoot with \p baseDir prepended, unless \p sourceRoot is
+///   absolute. \p pathBuf provides the storage for a combined path.
+static llvh::StringRef prependBaseDir(
+    llvh::StringRef baseDir,
+    llvh::StringRef sourceRoot,
+    llvh::SmallVectorImpl<char> &pathBuf) {
+  if (baseDir.empty() || llvh::sys::path::is_absolute(sourceRoot)) {
+    return sourceRoot;
+  }
+  if (sourceRoot.empty()) {
+    return baseDir;
+  }
+  pathBuf.assign(baseDir.begin(), baseDir.end());
+  llvh::sys::path::append(pathBuf, sourceRoot);
+  llvh::sys::path::remove_dots(pathBuf, true);
+#ifdef _WIN32
+  // Source map paths use forward slashes per the spec. LLVM path
+  // utilities convert to backslashes on Windows, so normalize back.
+  std::replace(pathBuf.begin(), pathBuf.end(), '\\', '/');
+#endif
+  return llvh::StringRef(pathBuf.data(), pathBuf.size());
+}
+
 std::unique_ptr<SourceMap> SourceMapParser::parse(
     llvh::MemoryBufferRef sourceMap,
     llvh::StringRef baseDir,
-    SourceErrorManager &sm) {
+    SourceErrorManager &sm,
+    bool lazy) {
   std::shared_ptr<parser::JSLexer::Allocator> alloc =
       std::make_shared<parser::JSLexer::Allocator>();
   parser::JSONFactory factory(*alloc);
@@ -101,7 +126,14 @@ std::unique_ptr<SourceMap> SourceMapParser::parse(
   }
 
   std::vector<SourceMap::SegmentList> lines;
-  bool succeed = parseMappings(mappings->str(), lines);
+  std::unique_ptr<SourceMapIndex> index;
+  bool succeed;
+  if (lazy) {
+    index = SourceMapIndex::build(mappings->str());
+    succeed = index != nullptr;
+  } else {
+    succeed = parseMappings(mappings->str(), lines);
+  }
   if (!succeed) {
     sm.error(genericLoc, "Failed to parse source map mappings");
     return nullptr;
@@ -110,22 +142,16 @@ std::unique_ptr<SourceMap> SourceMapParser::parse(
   llvh::StringRef originalSourceRoot = sourceRoot;
   llvh::SmallString<32> pathBuf{};
   // Optionally prepend baseDir to sources.
-  if (!baseDir.empty() && !llvh::sys::path::is_absolute(sourceRoot)) {
-    if (sourceRoot.empty()) {
-      sourceRoot = baseDir;
-    } else {
-      pathBuf = baseDir;
-      llvh::sys::path::append(pathBuf, sourceRoot);
-      llvh::sys::path::remove_dots(pathBuf, true);
-#ifdef _WIN32
-      // Source map paths use forward slashes per the spec. LLVM path
-      // utilities convert to backslashes on Windows, so normalize back.
-      std::replace(pathBuf.begin(), pathBuf.end(), '\\', '/');
-#endif
-      sourceRoot = pathBuf;
-    }
+  sourceRoot = prependBaseDir(baseDir, sourceRoot, pathBuf);
+
+  if (index) {
+    return std::make_unique<SourceMap>(
+        sourceRoot,
+        originalSourceRoot,
+        std::move(sources),
+        std::move(index),
+        std::move(sourcesMetadata));
   }
-
   return std::make_unique<SourceMap>(
       sourceRoot,
       originalSourceRoot,
@@ -134,6 +160,36 @@ std::unique_ptr<SourceMap> SourceMapParser::parse(
       std::move(sourcesMetadata));
 }
 
+bool SourceMapParser::isIndex(llvh::MemoryBufferRef buffer) {
+  return SourceMapIndex::isSerialized(buffer.getBuffer());
+}
+
+std::unique_ptr<SourceMap> SourceMapParser::loadIndex(
+    std::unique_ptr<llvh::MemoryBuffer> buffer,
+    llvh::StringRef baseDir,
+    SourceErrorManager &sm) {
+  std::string originalSourceRoot;
+  std::vector<std::string> sources;
+  std::string error;
+  std::unique_ptr<SourceMapIndex> index = SourceMapIndex::read(
+      std::move(buffer), originalSourceRoot, sources, error);
+  if (!index) {
+    // The index is not a source buffer of sm, so there is no location.
+    sm.error(SMLoc{}, error);
+    return nullptr;
+  }
+
+  llvh::SmallString<32> pathBuf{};
+  llvh::StringRef sourceRoot =
+      prependBaseDir(baseDir, originalSourceRoot, pathBuf);
+  return std::make_unique<SourceMap>(
+      sourceRoot,
+      originalSourceRoot,
+      std::move(sources),
+      std::move(index),
+      SourceMap::MetadataList{});
+}
+
 bool SourceMapParser::parseMappings(
     llvh::StringRef sourceMappings,
     std::vector<SourceMap::SegmentList> &lines) {
@@ -167,17 +223,7 @@ bool SourceMapParser::parseMappings(
         return false;
       }
 
-      state.generatedColumn = segmentOpt->generatedColumn;
-      if (segmentOpt->representedLocation.hasValue()) {
-        state.sourceIndex = segmentOpt->representedLocation->sourceIndex;
-        state.representedLine = segmentOpt->representedLocation->lineIndex;
-        state.representedColumn = segmentOpt->representedLocation->columnIndex;
-
-        if (segmentOpt->representedLocation->nameIndex.hasValue()) {
-          state.nameIndex =
-              segmentOpt->representedLocation->nameIndex.getValue();
-        }
-      }
+      updateState(state, *segmentOpt);
 
       segments.emplace_back(segmentOpt.getValue());
 
@@ -195,6 +241,21 @@ bool SourceMapParser::parseMappings(
   return true;
 }
 
+void SourceMapParser::updateState(
+    State &state,
+    const SourceMap::Segment &segment) {
+  state.generatedColumn = segment.generatedColumn;
+  if (segment.representedLocation.hasValue()) {
+    state.sourceIndex = segment.representedLocation->sourceIndex;
+    state.representedLine = segment.representedLocation->lineIndex;
+    state.representedColumn = segment.representedLocation->columnIndex;
+
+    if (segment.representedLocation->nameIndex.hasValue()) {
+      state.nameIndex = segment.representedLocation->nameIndex.getValue();
+    }
+  }
+}
+
 llvh::Optional<SourceMap::Segment> SourceMapParser::parseSegment(
     const SourceMapParser::State &state,
     const char *&pCur,
@@ -45,7 +45,8 @@ extern "C" HermesSourceMap *hermes_source_map_parse(
   SimpleDiagHandlerRAII handler(sm);
 
   llvh::MemoryBufferRef mbref(llvh::StringRef{source, len - 1}, "<source map>");
-  auto sourceMap = SourceMapParser::parse(mbref, {}, sm);
+  // Symbolication looks up few locations, so decode segments on demand.
+  auto sourceMap = SourceMapParser::parse(mbref, {}, sm, /* lazy */ true);
   // Defensive programming.
   if (!sourceMap && !handler.haveErrors())
     sm.error(SMLoc{}, "internal error");
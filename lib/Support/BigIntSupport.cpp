@@ -1025,6 +1025,529 @@ std::optional<ParsedBigInt> ParsedBigInt::parsedBigIntFromNumericValue(
   return ret;
 }
 
+namespace {
+//===----------------------------------------------------------------------===//
+// Unsigned arithmetic on magnitudes, used by the subquadratic algorithms for
+// multiplication, division and radix conversion below. All digit arrays are
+// little-endian.
+//===----------------------------------------------------------------------===//
+
+/// Operands with fewer digits than this are multiplied with the schoolbook
+/// algorithm. Tuned with benchmarks/micros/bigint.js.
+static constexpr uint32_t KaratsubaThresholdInDigits = 32;
+
+/// Divisions whose quotient has fewer bits than this are performed with
+/// Knuth's algorithm D. Tuned with benchmarks/micros/bigint.js.
+static constexpr uint32_t BurnikelZieglerThresholdInBits =
+    40 * BigIntDigitSizeInBits;
+
+/// Numbers with fewer digits than this are converted to strings by repeated
+/// division by the largest power of the radix that fits in a digit. Tuned with
+/// benchmarks/micros/bigint.js.
+static constexpr uint32_t ToStringThresholdInDigits = 24;
+
+/// Add \p src (with \p srcSize digits) to \p dst (with \p dstSize digits) in
+/// place, with srcSize <= dstSize.
+/// \return the carry out of dst.
+static BigIntDigitType addDigits(
+    BigIntDigitType *dst,
+    uint32_t dstSize,
+    const BigIntDigitType *src,
+    uint32_t srcSize) {
+  assert(srcSize <= dstSize && "src must not be larger than dst");
+  BigIntDigitType carry = 0;
+  uint32_t i = 0;
+  for (; i < srcSize; ++i) {
+    BigIntDigitType sum = dst[i] + carry;
+    carry = sum < carry;
+    sum += src[i];
+    carry += sum < src[i];
+    dst[i] = sum;
+  }
+  for (; carry && i < dstSize; ++i) {
+    carry = ++dst[i] == 0;
+  }
+  return carry;
+}
+
+/// Subtract \p src (with \p srcSize digits) from \p dst (with \p dstSize
+/// digits) in place, with srcSize <= dstSize.
+/// \return the borrow out of dst.
+static BigIntDigitType subtractDigits(
+    BigIntDigitType *dst,
+    uint32_t dstSize,
+    const BigIntDigitType *src,
+    uint32_t srcSize) {
+  assert(srcSize <= dstSize && "src must not be larger than dst");
+  BigIntDigitType borrow = 0;
+  uint32_t i = 0;
+  for (; i < srcSize; ++i) {
+    BigIntDigitType sub = src[i] + borrow;
+    BigIntDigitType newBorrow = (sub < borrow) | (dst[i] < sub);
+    dst[i] -= sub;
+    borrow = newBorrow;
+  }
+  for (; borrow && i < dstSize; ++i) {
+    borrow = dst[i]-- == 0;
+  }
+  return borrow;
+}
+
+/// \return the number of digits in \p digits, ignoring leading zeros.
+static uint32_t significantDigits(
+    const BigIntDigitType *digits,
+    uint32_t numDigits) {
+  while (numDigits > 0 && digits[numDigits - 1] == 0) {
+    --numDigits;
+  }
+  return numDigits;
+}
+
+/// Compute \p dst = \p lhs * \p rhs, where dst has lhsSize + rhsSize digits
+/// and doesn't overlap the operands. Large balanced operands are multiplied
+/// with Karatsuba's algorithm, and unbalanced ones are split into balanced
+/// products.
+static void multiplyDigits(
+    BigIntDigitType *dst,
+    const BigIntDigitType *lhs,
+    uint32_t lhsSize,
+    const BigIntDigitType *rhs,
+    uint32_t rhsSize) {
+  if (lhsSize < rhsSize) {
+    std::swap(lhs, rhs);
+    std::swap(lhsSize, rhsSize);
+  }
+  const uint32_t dstSize = lhsSize + rhsSize;
+
+  if (rhsSize == 0) {
+    memset(dst, 0, dstSize * BigIntDigitSizeInBytes);
+    return;
+  }
+
+  if (rhsSize < KaratsubaThresholdInDigits) {
+    llvh::APInt::tcFullMultiply(dst, lhs, rhs, lhsSize, rhsSize);
+    return;
+  }
+
+  if (lhsSize >= 2 * rhsSize) {
+    // Multiply rhs by rhsSize-digit slices of lhs, and accumulate the
+    // products.
+    memset(dst, 0, dstSize * BigIntDigitSizeInBytes);
+    llvh::SmallVector<BigIntDigitType, 64> product(2 * rhsSize);
+    for (uint32_t offset = 0; offset < lhsSize; offset += rhsSize) {
+      const uint32_t sliceSize = std::min(rhsSize, lhsSize - offset);
+      multiplyDigits(product.data(), lhs + offset, sliceSize, rhs, rhsSize);
+      addDigits(
+          dst + offset, dstSize - offset, product.data(), sliceSize + rhsSize);
+    }
+    return;
+  }
+
+  // Karatsuba: with B = 2^(64 * half), lhs = lhs1 * B + lhs0 and
+  // rhs = rhs1 * B + rhs0,
+  //
+  //   lhs * rhs = z2 * B^2 + z1 * B + z0, where
+  //   z0 = lhs0 * rhs0,
+  //   z2 = lhs1 * rhs1, and
+  //   z1 = (lhs0 + lhs1) * (rhs0 + rhs1) - z0 - z2.
+  //
+  // lhsSize < 2 * rhsSize, so half <= rhsSize, and rhs1 may be empty.
+  const uint32_t half = (lhsSize + 1) / 2;
+  const uint32_t lhs1Size = lhsSize - half;
+  const uint32_t rhs1Size = rhsSize - half;
+
+  // z0 and z2 are computed directly into their place in dst.
+  multiplyDigits(dst, lhs, half, rhs, half);
+  multiplyDigits(dst + 2 * half, lhs + half, lhs1Size, rhs + half, rhs1Size);
+
+  const uint32_t sumSize = half + 1;
+  llvh::SmallVector<BigIntDigitType, 64> tmp(4 * sumSize);
+  BigIntDigitType *lhsSum = tmp.data();
+  BigIntDigitType *rhsSum = lhsSum + sumSize;
+  BigIntDigitType *z1 = rhsSum + sumSize;
+  std::copy(lhs, lhs + half, lhsSum);
+  lhsSum[half] = addDigits(lhsSum, half, lhs + half, lhs1Size);
+  std::copy(rhs, rhs + half, rhsSum);
+  rhsSum[half] = addDigits(rhsSum, half, rhs + half, rhs1Size);
+
+  const uint32_t z1Size = 2 * sumSize;
+  multiplyDigits(z1, lhsSum, sumSize, rhsSum, sumSize);
+  subtractDigits(z1, z1Size, dst, 2 * half);
+  subtractDigits(z1, z1Size, dst + 2 * half, lhs1Size + rhs1Size);
+
+  // z1 = lhs0 * rhs1 + lhs1 * rhs0, so it fits in the digits of dst above B.
+  const uint32_t z1Significant = significantDigits(z1, z1Size);
+  assert(z1Significant <= dstSize - half && "z1 overflows the result");
+  addDigits(dst + half, dstSize - half, z1, z1Significant);
+}
+
+/// An arbitrary precision unsigned integer, without leading zero digits. Used
+/// for the intermediate results of the recursive algorithms.
+class Magnitude {
+ public:
+  Magnitude() = default;
+
+  Magnitude(const BigIntDigitType *digits, uint32_t numDigits)
+      : digits_(digits, digits + significantDigits(digits, numDigits)) {}
+
+  static Magnitude fromAPInt(const llvh::APInt &value) {
+    return Magnitude(value.getRawData(), value.getNumWords());
+  }
+
+  static Magnitude fromDigit(BigIntDigitType digit) {
+    return Magnitude(&digit, 1);
+  }
+
+  uint32_t size() const {
+    return digits_.size();
+  }
+
+  const BigIntDigitType *data() const {
+    return digits_.data();
+  }
+
+  bool isZero() const {
+    return digits_.empty();
+  }
+
+  uint32_t bitLength() const {
+    return isZero() ? 0
+                    : size() * BigIntDigitSizeInBits -
+            llvh::countLeadingZeros(digits_.back());
+  }
+
+  /// \return this number as an APInt with at least \p minDigits digits.
+  llvh::APInt toAPInt(uint32_t minDigits = 1) const {
+    const uint32_t numDigits = std::max({size(), minDigits, 1u});
+    llvh::SmallVector<BigIntDigitType, 16> words(
+        digits_.begin(), digits_.end());
+    words.resize(numDigits);
+    return llvh::APInt(numDigits * BigIntDigitSizeInBits, words);
+  }
+
+  /// Copy this number into \p dst, zero-extended to \p numDigits digits.
+  void copyTo(BigIntDigitType *dst, uint32_t numDigits) const {
+    assert(size() <= numDigits && "destination is too small");
+    std::copy(digits_.begin(), digits_.end(), dst);
+    memset(dst + size(), 0, (numDigits - size()) * BigIntDigitSizeInBytes);
+  }
+
+  friend int compare(const Magnitude &lhs, const Magnitude &rhs) {
+    if (lhs.size() != rhs.size()) {
+      return lhs.size() < rhs.size() ? -1 : 1;
+    }
+    return llvh::APInt::tcCompare(lhs.data(), rhs.data(), lhs.size());
+  }
+
+  friend bool operator<(const Magnitude &lhs, const Magnitude &rhs) {
+    return compare(lhs, rhs) < 0;
+  }
+
+  friend bool operator==(const Magnitude &lhs, const Magnitude &rhs) {
+    return compare(lhs, rhs) == 0;
+  }
+
+  Magnitude &operator+=(const Magnitude &rhs) {
+    if (size() < rhs.size()) {
+      digits_.resize(rhs.size());
+    }
+    if (addDigits(digits_.data(), size(), rhs.data(), rhs.size())) {
+      digits_.push_back(1);
+    }
+    return *this;
+  }
+
+  /// Subtract \p rhs, which must not be larger than this number.
+  Magnitude &operator-=(const Magnitude &rhs) {
+    assert(!(*this < rhs) && "magnitudes can't be negative");
+    subtractDigits(digits_.data(), size(), rhs.data(), rhs.size());
+    trim();
+    return *this;
+  }
+
+  friend Magnitude operator*(const Magnitude &lhs, const Magnitude &rhs) {
+    Magnitude result;
+    result.digits_.resize(lhs.size() + rhs.size());
+    multiplyDigits(
+        result.digits_.data(), lhs.data(), lhs.size(), rhs.data(), rhs.size());
+    result.trim();
+    return result;
+  }
+
+  friend Magnitude operator<<(const Magnitude &lhs, uint32_t bits) {
+    if (lhs.isZero()) {
+      return lhs;
+    }
+    Magnitude result;
+    const uint32_t digitShift = bits / BigIntDigitSizeInBits;
+    const uint32_t bitShift = bits % BigIntDigitSizeInBits;
+    result.digits_.resize(lhs.size() + digitShift + 1);
+    std::copy(
+        lhs.digits_.begin(),
+        lhs.digits_.end(),
+        result.digits_.begin() + digitShift);
+    llvh::APInt::tcShiftLeft(
+        result.digits_.data() + digitShift, lhs.size() + 1, bitShift);
+    result.trim();
+    return result;
+  }
+
+  friend Magnitude operator>>(const Magnitude &lhs, uint32_t bits) {
+    const uint32_t digitShift = bits / BigIntDigitSizeInBits;
+    if (digitShift >= lhs.size()) {
+      return Magnitude();
+    }
+    Magnitude result(lhs.data() + digitShift, lhs.size() - digitShift);
+    llvh::APInt::tcShiftRight(
+        result.digits_.data(), result.size(), bits % BigIntDigitSizeInBits);
+    result.trim();
+    return result;
+  }
+
+  /// \return the \p bits least significant bits of this number.
+  Magnitude lowBits(uint32_t bits) const {
+    if (bits >= bitLength()) {
+      return *this;
+    }
+    const uint32_t numDigits = numDigitsForSizeInBits(bits);
+    Magnitude result(data(), numDigits);
+    if (const uint32_t topBits = bits % BigIntDigitSizeInBits) {
+      result.digits_.resize(numDigits);
+      result.digits_.back() &= (BigIntDigitType(1) << topBits) - 1;
+      result.trim();
+    }
+    return result;
+  }
+
+ private:
+  void trim() {
+    digits_.resize(significantDigits(digits_.data(), digits_.size()));
+  }
+
+  llvh::SmallVector<BigIntDigitType, 8> digits_;
+};
+
+/// Compute \p quoc and \p rem for \p lhs / \p rhs with Knuth's algorithm D.
+static void divideKnuth(
+    const Magnitude &lhs,
+    const Magnitude &rhs,
+    Magnitude &quoc,
+    Magnitude &rem) {
+  const uint32_t numDigits = std::max(lhs.size(), rhs.size());
+  llvh::APInt q, r;
+  llvh::APInt::udivrem(lhs.toAPInt(numDigits), rhs.toAPInt(numDigits), q, r);
+  quoc = Magnitude::fromAPInt(q);
+  rem = Magnitude::fromAPInt(r);
+}
+
+static void divide2n1n(
+    Magnitude lhs,
+    Magnitude rhs,
+    uint32_t n,
+    Magnitude &quoc,
+    Magnitude &rem);
+
+/// The 3n/2n step of Burnikel-Ziegler division: divide lhs12 * 2^n + lhs3 by
+/// \p rhs = rhs1 * 2^n + rhs2, a 2n-bit number, where lhs12 < rhs * 2^n.
+static void divide3n2n(
+    const Magnitude &lhs12,
+    const Magnitude &lhs3,
+    const Magnitude &rhs,
+    const Magnitude &rhs1,
+    const Magnitude &rhs2,
+    uint32_t n,
+    Magnitude &quoc,
+    Magnitude &rem) {
+  if ((lhs12 >> n) == rhs1) {
+    // The quotient estimate is 2^n - 1, with remainder lhs12 - quoc * rhs1.
+    quoc = (Magnitude::fromDigit(1) << n);
+    quoc -= Magnitude::fromDigit(1);
+    rem = lhs12;
+    rem += rhs1;
+    rem -= rhs1 << n;
+  } else {
+    divide2n1n(lhs12, rhs1, n, quoc, rem);
+  }
+  rem = rem << n;
+  rem += lhs3;
+  // The estimate is at most 2 more than the actual quotient.
+  Magnitude correction = quoc * rhs2;
+  while (rem < correction) {
+    quoc -= Magnitude::fromDigit(1);
+    rem += rhs;
+  }
+  rem -= correction;
+}
+
+/// Burnikel-Ziegler recursive division of a 2n-bit \p lhs by an n-bit \p rhs,
+/// where lhs < rhs * 2^n.
+static void divide2n1n(
+    Magnitude lhs,
+    Magnitude rhs,
+    uint32_t n,
+    Magnitude &quoc,
+    Magnitude &rem) {
+  if (lhs.bitLength() <= n + BurnikelZieglerThresholdInBits) {
+    divideKnuth(lhs, rhs, quoc, rem);
+    return;
+  }
+
+  // Make n even so that rhs can be split in halves.
+  const bool pad = n & 1;
+  if (pad) {
+    lhs = lhs << 1;
+    rhs = rhs << 1;
+    ++n;
+  }
+  const uint32_t half = n / 2;
+  const Magnitude rhs1 = rhs >> half;
+  const Magnitude rhs2 = rhs.lowBits(half);
+
+  Magnitude quoc1, quoc2, rem1;
+  divide3n2n(
+      lhs >> n,
+      (lhs >> half).lowBits(half),
+      rhs,
+      rhs1,
+      rhs2,
+      half,
+      quoc1,
+      rem1);
+  divide3n2n(rem1, lhs.lowBits(half), rhs, rhs1, rhs2, half, quoc2, rem);
+  if (pad) {
+    rem = rem >> 1;
+  }
+  quoc = quoc1 << half;
+  quoc += quoc2;
+}
+
+/// Compute \p quoc and \p rem for \p lhs / \p rhs, with rhs != 0. Large
+/// divisions use the Burnikel-Ziegler algorithm: lhs is split into chunks with
+/// as many bits as rhs, which are divided from the most significant one, each
+/// time carrying the remainder over to the next chunk.
+static void divideMagnitudes(
+    const Magnitude &lhs,
+    const Magnitude &rhs,
+    Magnitude &quoc,
+    Magnitude &rem) {
+  assert(!rhs.isZero() && "division by zero");
+  const uint32_t n = rhs.bitLength();
+  if (lhs.bitLength() <= n + BurnikelZieglerThresholdInBits) {
+    divideKnuth(lhs, rhs, quoc, rem);
+    return;
+  }
+
+  const uint32_t numChunks = (lhs.bitLength() + n - 1) / n;
+  quoc = Magnitude();
+  rem = Magnitude();
+  for (uint32_t i = numChunks; i-- > 0;) {
+    Magnitude chunkQuoc;
+    Magnitude chunk = rem << n;
+    chunk += (lhs >> (i * n)).lowBits(n);
+    divide2n1n(chunk, rhs, n, chunkQuoc, rem);
+    quoc = quoc << n;
+    quoc += chunkQuoc;
+  }
+}
+
+/// \return the character for digit \p d.
+static char digitToChar(uint64_t d) {
+  return d < 10 ? '0' + d : 'a' + d - 10;
+}
+
+/// Radix conversion state: the largest power of the radix that fits in a
+/// digit, and its squares, which split numbers for divide-and-conquer.
+struct RadixPowers {
+  uint8_t radix;
+  /// The number of characters in \c powers[0].
+  uint32_t charsPerDigit;
+  /// powers[i] = radix ^ (charsPerDigit * 2^i).
+  llvh::SmallVector<Magnitude, 8> powers;
+};
+
+/// Append the representation of \p value to \p out, left-padded with zeros to
+/// \p minChars characters, by repeatedly dividing it by powers[0].
+static void appendDigitsSchoolbook(
+    std::string &out,
+    const Magnitude &value,
+    const RadixPowers &rp,
+    size_t minChars) {
+  std::string reversed;
+  if (!value.isZero()) {
+    const uint64_t divisor = rp.powers[0].data()[0];
+    llvh::APInt tmp = value.toAPInt();
+    do {
+      llvh::APInt quoc;
+      uint64_t rem;
+      llvh::APInt::udivrem(tmp, divisor, quoc, rem);
+      const bool isLast = quoc == 0;
+      for (uint32_t i = 0; i < rp.charsPerDigit && (!isLast || rem); ++i) {
+        reversed.push_back(digitToChar(rem % rp.radix));
+        rem /= rp.radix;
+      }
+      tmp = std::move(quoc);
+    } while (tmp != 0);
+  }
+  if (reversed.size() < minChars) {
+    reversed.append(minChars - reversed.size(), '0');
+  }
+  out.append(reversed.rbegin(), reversed.rend());
+}
+
+/// Append the representation of \p value, where value < powers[level]^2, to
+/// \p out, left-padded with zeros to \p minChars characters. The value is
+/// split in halves by dividing it by powers[level], and each half is
+/// converted recursively.
+static void appendDigitsRecursive(
+    std::string &out,
+    const Magnitude &value,
+    const RadixPowers &rp,
+    int level,
+    size_t minChars) {
+  if (level < 0 || value.size() < ToStringThresholdInDigits) {
+    appendDigitsSchoolbook(out, value, rp, minChars);
+    return;
+  }
+  const Magnitude &power = rp.powers[level];
+  if (value < power) {
+    appendDigitsRecursive(out, value, rp, level - 1, minChars);
+    return;
+  }
+  Magnitude high, low;
+  divideMagnitudes(value, power, high, low);
+  const size_t lowChars = size_t(rp.charsPerDigit) << level;
+  appendDigitsRecursive(
+      out, high, rp, level - 1, minChars > lowChars ? minChars - lowChars : 0);
+  appendDigitsRecursive(out, low, rp, level - 1, lowChars);
+}
+
+/// Append the representation of \p value in \p radix to \p out.
+static void appendDigits(
+    std::string &out,
+    const Magnitude &value,
+    uint8_t radix) {
+  RadixPowers rp;
+  rp.radix = radix;
+  rp.charsPerDigit = 1;
+  BigIntDigitType power = radix;
+  while (power <= std::numeric_limits<BigIntDigitType>::max() / radix) {
+    power *= radix;
+    ++rp.charsPerDigit;
+  }
+  rp.powers.push_back(Magnitude::fromDigit(power));
+
+  if (value.size() < ToStringThresholdInDigits) {
+    appendDigitsSchoolbook(out, value, rp, 0);
+    return;
+  }
+  // Square the power until its square exceeds value.
+  while (rp.powers.back().size() <= (value.size() + 1) / 2) {
+    rp.powers.push_back(rp.powers.back() * rp.powers.back());
+  }
+  appendDigitsRecursive(out, value, rp, rp.powers.size() - 1, 0);
+}
+} // namespace
+
 std::string toString(ImmutableBigIntRef src, uint8_t radix) {
   assert(radix >= 2 && radix <= 36);
 
@@ -1036,36 +1559,20 @@ std::string toString(ImmutableBigIntRef src, uint8_t radix) {
   const bool sign = isNegative(src);
   llvh::APInt tmp(numBits, llvh::makeArrayRef(src.digits, src.numDigits));
 
-  if (sign) {
-    // negate negative numbers, and then add a "-" to the output.
-    tmp.negate();
-  }
-
   std::string digits;
 
   // avoid trashing the heap by pre-allocating the largest possible string
   // returned by this function. The "1" below is to account for a possible "-"
   // sign.
   digits.reserve(1 + src.numDigits * maxCharsPerDigitInRadix(radix));
-  do {
-    llvh::APInt quoc;
-    uint64_t rem;
-    llvh::APInt::udivrem(tmp, static_cast<uint64_t>(radix), quoc, rem);
-
-    if (rem < 10) {
-      digits.push_back('0' + rem);
-    } else {
-      digits.push_back('a' + rem - 10);
-    }
-
-    tmp = std::move(quoc);
-  } while (tmp != 0);
 
   if (sign) {
+    // negate negative numbers, and then add a "-" to the output.
+    tmp.negate();
     digits.push_back('-');
   }
 
-  std::reverse(digits.begin(), digits.end());
+  appendDigits(digits, Magnitude::fromAPInt(tmp), radix);
   return digits;
 }
 
@@ -1651,7 +2158,7 @@ multiply(MutableBigIntRef dst, ImmutableBigIntRef lhs, ImmutableBigIntRef rhs) {
   const bool isLhsNegative = isNegative(lhs);
   const bool isRhsNegative = isNegative(rhs);
 
-  // tcFullMultiply operates on unsigned quantities, so lhs/rhs may need to be
+  // multiplyDigits operates on unsigned quantities, so lhs/rhs may need to be
   // negated. They could temporarily negated in place, but that violates the
   // promise the API makes by taking ImmutableBigIntRefs. The solution is thus
   // to allocate temporary buffers for negating the inputs when needed.
@@ -1670,7 +2177,7 @@ multiply(MutableBigIntRef dst, ImmutableBigIntRef lhs, ImmutableBigIntRef rhs) {
   //     * result.digits[1] = 0x0000000000000000
   //
   // i.e., there's an explicit zero-extension of the result, which is
-  // superfluous given tcFullMultiply assumption of unsigned operands.
+  // superfluous given multiplyDigits assumption of unsigned operands.
   uint32_t tmpStorageSizeLhs = isLhsNegative ? lhs.numDigits : 0;
   uint32_t tmpStorageSizeRhs = isRhsNegative ? rhs.numDigits : 0;
   const uint32_t tmpStorageSize = tmpStorageSizeLhs + tmpStorageSizeRhs;
@@ -1715,10 +2222,11 @@ multiply(MutableBigIntRef dst, ImmutableBigIntRef lhs, ImmutableBigIntRef rhs) {
 
   // if dstSize is zero, then there's no need to perform the multiplication.
   if (dstSize > 0) {
-    // tcFullMultiply returns a result with lhs.numDigits + rhs.numDigits. Thus,
-    // there could be extraneous digits in dst that are not initialized by it.
-    llvh::APInt::tcFullMultiply(
-        dst.digits, lhs.digits, rhs.digits, lhs.numDigits, rhs.numDigits);
+    // multiplyDigits returns a result with lhs.numDigits + rhs.numDigits.
+    // Thus, there could be extraneous digits in dst that are not initialized by
+    // it.
+    multiplyDigits(
+        dst.digits, lhs.digits, lhs.numDigits, rhs.digits, rhs.numDigits);
 
     // Zero out extranous digits in dst. These digits are used to simulate
     // infinite precision when multiplying negative and positive numbers.
@@ -1777,33 +2285,27 @@ static OperationStatus compute(
     return OperationStatus::DIVISION_BY_ZERO;
   }
 
-  // tcDivide operates on unsigned number, so just like multiply, the operands
-  // must be negated (and the result as well, if appropriate) if they are
-  // negative.
+  // divideMagnitudes operates on unsigned numbers, so just like multiply, the
+  // operands must be negated (and the result as well, if appropriate) if they
+  // are negative.
   const bool isLhsNegative = isNegative(lhs);
   const bool isRhsNegative = isNegative(rhs);
 
-  // If rhs has fewer digits than quoc/rem it must be resized.
-  const bool needToResizeRhs = rhs.numDigits < resultSize;
-
   // Figure out which temporary buffers are needed -- this determines how much
   // temporary storage will be allocated for the division.
   const bool needTmpQuoc = quoc.digits == nullptr;
   const bool needTmpRem = rem.digits == nullptr;
-  const bool needTmpRhs = isRhsNegative || needToResizeRhs;
+  const bool needTmpRhs = isRhsNegative;
 
-  uint32_t tmpStorageSizeScratch = resultSize;
   uint32_t tmpStorageSizeQuoc = needTmpQuoc ? resultSize : 0;
   uint32_t tmpStorageSizeRem = needTmpRem ? resultSize : 0;
   uint32_t tmpStorageSizeRhs = needTmpRhs ? resultSize : 0;
 
-  const uint32_t tmpStorageSize = tmpStorageSizeScratch + tmpStorageSizeQuoc +
-      tmpStorageSizeRem + tmpStorageSizeRhs;
+  const uint32_t tmpStorageSize =
+      tmpStorageSizeQuoc + tmpStorageSizeRem + tmpStorageSizeRhs;
 
   TmpStorage tmpStorage(tmpStorageSize);
 
-  BigIntDigitType *scratch = tmpStorage.requestNumDigits(tmpStorageSizeScratch);
-
   if (needTmpQuoc) {
     assert(quoc.numDigits == tmpStorageSizeQuoc);
     quoc.digits = tmpStorage.requestNumDigits(tmpStorageSizeQuoc);
@@ -1824,10 +2326,10 @@ static OperationStatus compute(
     rhs = ImmutableBigIntRef{tmpRhs.digits, tmpRhs.numDigits};
   }
 
-  // tcDivide is in-place (i.e. quoc is lhs), so division will be expressed as
+  // The division will be expressed as
   //
   // quoc = signExt(lhs)
-  // quoc, rem, scratch /= signExt(rhs)
+  // quoc, rem = quoc / rhs
   auto res = initNonCanonicalWithReadOnlyBigInt(quoc, lhs);
   assert(res == OperationStatus::RETURNED && "quoc array is too small");
   (void)res;
@@ -1838,8 +2340,14 @@ static OperationStatus compute(
     llvh::APInt::tcNegate(quoc.digits, quoc.numDigits);
   }
 
-  llvh::APInt::tcDivide(
-      quoc.digits, rhs.digits, rem.digits, scratch, resultSize);
+  Magnitude quocMag, remMag;
+  divideMagnitudes(
+      Magnitude(quoc.digits, quoc.numDigits),
+      Magnitude(rhs.digits, rhs.numDigits),
+      quocMag,
+      remMag);
+  quocMag.copyTo(quoc.digits, quoc.numDigits);
+  remMag.copyTo(rem.digits, rem.numDigits);
 
   // post-process quoc if no space was allocated for it in the temporary storage
   // -- i.e., the caller wants the quoc.
@@ -0,0 +1,306 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+/// \file FastCharScan.cpp
+/// SIMD-accelerated scanning of character runs, used by the JavaScript lexer,
+/// by text decoding and by JSON.stringify.
+///
+/// Each scanner classifies 16 bytes at a time and stops at the first byte
+/// outside the class, falling back to scalar code for the final bytes before
+/// the end of the buffer. All classes only admit ASCII characters, so bytes
+/// with the high bit set always terminate a run and are left for the caller
+/// to decode.
+///
+/// SSE2 (x86-64) strategy:
+///   1. Load 16 bytes (_mm_loadu_si128) and build a per-byte class mask from
+///      equality (_mm_cmpeq_epi8) and range checks. SSE2 only has signed byte
+///      comparisons (_mm_cmpgt_epi8/_mm_cmplt_epi8), which is what we want:
+///      non-ASCII bytes are negative and fall outside every ASCII range.
+///   2. Collapse the mask into one bit per byte (_mm_movemask_epi8) and use
+///      countTrailingZeros to find the first byte that ends the run.
+///
+/// NEON (aarch64) strategy:
+///   1. Load 16 bytes (vld1q_u8) and build the class mask with vceqq_u8,
+///      vcgeq_u8 and vcleq_u8. Comparisons are unsigned, so non-ASCII bytes
+///      (>= 0x80) again fall outside every ASCII range.
+///   2. Narrow the mask to 4 bits per byte by shifting each 16-bit lane right
+///      by 4 and keeping the low byte (vshrn_n_u16), read the result as a
+///      64-bit scalar and divide countTrailingZeros by 4.
+
+#include "hermes/Support/FastCharScan.h"
+#include "hermes/Support/SIMD.h"
+
+#include "llvh/Support/MathExtras.h"
+
+#include <cassert>
+#include <cstdint>
+
+namespace hermes {
+namespace {
+
+/// \return true if \p ch is [A-Za-z0-9_$] or \p extra.
+inline bool isASCIIIdentifierChar(char ch, char extra) {
+  return ch == '_' || ch == '$' || ((ch | 32) >= 'a' && (ch | 32) <= 'z') ||
+      (ch >= '0' && ch <= '9') || ch == extra;
+}
+
+/// \return true if \p ch ends a run scanned by scanUntilSpecialChar.
+inline bool isSpecialChar(char ch, char stop1, char stop2) {
+  return ch == stop1 || ch == stop2 || ch == '\n' || ch == '\r' || ch == 0 ||
+      (ch & 0x80) != 0;
+}
+
+/// \return true if \p ch ends a run scanned by scanUntilJSONEscape.
+inline bool isJSONEscapeChar(char ch) {
+  return ch == '"' || ch == '\\' || static_cast<uint8_t>(ch) < 0x20 ||
+      (ch & 0x80) != 0;
+}
+
+#ifdef HERMES_SIMD_NEON
+/// Collapse a byte comparison result whose lanes are 0x00 or 0xFF into a
+/// 64-bit mask with 4 bits per lane.
+inline uint64_t nibbleMask(uint8x16_t cmp) {
+  uint8x8_t narrowed = vshrn_n_u16(vreinterpretq_u16_u8(cmp), 4);
+  return vget_lane_u64(vreinterpret_u64_u8(narrowed), 0);
+}
+#endif
+
+} // namespace
+
+const char *scanASCIIIdentifierChars(
+    const char *cur,
+    const char *end,
+    char extra) {
+  assert(cur <= end && "cur must be <= end");
+
+#ifdef HERMES_SIMD_NEON
+  const uint8x16_t lowerA = vdupq_n_u8('a');
+  const uint8x16_t lowerZ = vdupq_n_u8('z');
+  const uint8x16_t digit0 = vdupq_n_u8('0');
+  const uint8x16_t digit9 = vdupq_n_u8('9');
+  const uint8x16_t caseBit = vdupq_n_u8(0x20);
+  const uint8x16_t underscore = vdupq_n_u8('_');
+  const uint8x16_t dollar = vdupq_n_u8('$');
+  const uint8x16_t extraV = vdupq_n_u8(static_cast<uint8_t>(extra));
+  while (end - cur >= 16) {
+    uint8x16_t data = vld1q_u8(reinterpret_cast<const uint8_t *>(cur));
+    // Setting bit 5 maps upper case letters onto lower case ones.
+    uint8x16_t lower = vorrq_u8(data, caseBit);
+    uint8x16_t alpha =
+        vandq_u8(vcgeq_u8(lower, lowerA), vcleq_u8(lower, lowerZ));
+    uint8x16_t digit =
+        vandq_u8(vcgeq_u8(data, digit0), vcleq_u8(data, digit9));
+    uint8x16_t other = vorrq_u8(
+        vorrq_u8(vceqq_u8(data, underscore), vceqq_u8(data, dollar)),
+        vceqq_u8(data, extraV));
+    uint64_t stop = ~nibbleMask(vorrq_u8(vorrq_u8(alpha, digit), other));
+    if (stop)
+      return cur + llvh::countTrailingZeros(stop) / 4;
+    cur += 16;
+  }
+#elif defined(HERMES_SIMD_SSE2)
+  const __m128i belowA = _mm_set1_epi8('a' - 1);
+  const __m128i aboveZ = _mm_set1_epi8('z' + 1);
+  const __m128i below0 = _mm_set1_epi8('0' - 1);
+  const __m128i above9 = _mm_set1_epi8('9' + 1);
+  const __m128i caseBit = _mm_set1_epi8(0x20);
+  const __m128i underscore = _mm_set1_epi8('_');
+  const __m128i dollar = _mm_set1_epi8('$');
+  const __m128i extraV = _mm_set1_epi8(extra);
+  while (end - cur >= 16) {
+    __m128i data = _mm_loadu_si128(reinterpret_cast<const __m128i *>(cur));
+    // Setting bit 5 maps upper case letters onto lower case ones.
+    __m128i lower = _mm_or_si128(data, caseBit);
+    __m128i alpha = _mm_and_si128(
+        _mm_cmpgt_epi8(lower, belowA), _mm_cmplt_epi8(lower, aboveZ));
+    __m128i digit = _mm_and_si128(
+        _mm_cmpgt_epi8(data, below0), _mm_cmplt_epi8(data, above9));
+    __m128i other = _mm_or_si128(
+        _mm_or_si128(
+            _mm_cmpeq_epi8(data, underscore), _mm_cmpeq_epi8(data, dollar)),
+        _mm_cmpeq_epi8(data, extraV));
+    __m128i ident = _mm_or_si128(_mm_or_si128(alpha, digit), other);
+    unsigned stop = ~static_cast<unsigned>(_mm_movemask_epi8(ident)) & 0xFFFF;
+    if (stop)
+      return cur + llvh::countTrailingZeros(stop);
+    cur += 16;
+  }
+#endif
+
+  // Scalar tail.
+  while (cur != end && isASCIIIdentifierChar(*cur, extra))
+    ++cur;
+  return cur;
+}
+
+const char *skipSpacesAndTabs(const char *cur, const char *end) {
+  assert(cur <= end && "cur must be <= end");
+
+  // Most runs of whitespace between tokens are a single space, so check the
+  // first character before paying for a vector load.
+  if (cur == end || (*cur != ' ' && *cur != '\t'))
+    return cur;
+
+#ifdef HERMES_SIMD_NEON
+  const uint8x16_t space = vdupq_n_u8(' ');
+  const uint8x16_t tab = vdupq_n_u8('\t');
+  while (end - cur >= 16) {
+    uint8x16_t data = vld1q_u8(reinterpret_cast<const uint8_t *>(cur));
+    uint64_t stop = ~nibbleMask(
+        vorrq_u8(vceqq_u8(data, space), vceqq_u8(data, tab)));
+    if (stop)
+      return cur + llvh::countTrailingZeros(stop) / 4;
+    cur += 16;
+  }
+#elif defined(HERMES_SIMD_SSE2)
+  const __m128i space = _mm_set1_epi8(' ');
+  const __m128i tab = _mm_set1_epi8('\t');
+  while (end - cur >= 16) {
+    __m128i data = _mm_loadu_si128(reinterpret_cast<const __m128i *>(cur));
+    __m128i blank =
+        _mm_or_si128(_mm_cmpeq_epi8(data, space), _mm_cmpeq_epi8(data, tab));
+    unsigned stop = ~static_cast<unsigned>(_mm_movemask_epi8(blank)) & 0xFFFF;
+    if (stop)
+      return cur + llvh::countTrailingZeros(stop);
+    cur += 16;
+  }
+#endif
+
+  // Scalar tail.
+  while (cur != end && (*cur == ' ' || *cur == '\t'))
+    ++cur;
+  return cur;
+}
+
+const char *scanUntilSpecialChar(
+    const char *cur,
+    const char *end,
+    char stop1,
+    char stop2) {
+  assert(cur <= end && "cur must be <= end");
+
+#ifdef HERMES_SIMD_NEON
+  const uint8x16_t stop1V = vdupq_n_u8(static_cast<uint8_t>(stop1));
+  const uint8x16_t stop2V = vdupq_n_u8(static_cast<uint8_t>(stop2));
+  const uint8x16_t lf = vdupq_n_u8('\n');
+  const uint8x16_t cr = vdupq_n_u8('\r');
+  const uint8x16_t zero = vdupq_n_u8(0);
+  const uint8x16_t nonASCII = vdupq_n_u8(0x80);
+  while (end - cur >= 16) {
+    uint8x16_t data = vld1q_u8(reinterpret_cast<const uint8_t *>(cur));
+    uint8x16_t special = vorrq_u8(
+        vorrq_u8(vceqq_u8(data, stop1V), vceqq_u8(data, stop2V)),
+        vorrq_u8(vceqq_u8(data, lf), vceqq_u8(data, cr)));
+    special = vorrq_u8(special, vceqq_u8(data, zero));
+    special = vorrq_u8(special, vcgeq_u8(data, nonASCII));
+    uint64_t mask = nibbleMask(special);
+    if (mask)
+      return cur + llvh::countTrailingZeros(mask) / 4;
+    cur += 16;
+  }
+#elif defined(HERMES_SIMD_SSE2)
+  const __m128i stop1V = _mm_set1_epi8(stop1);
+  const __m128i stop2V = _mm_set1_epi8(stop2);
+  const __m128i lf = _mm_set1_epi8('\n');
+  const __m128i cr = _mm_set1_epi8('\r');
+  const __m128i zero = _mm_setzero_si128();
+  while (end - cur >= 16) {
+    __m128i data = _mm_loadu_si128(reinterpret_cast<const __m128i *>(cur));
+    __m128i special = _mm_or_si128(
+        _mm_or_si128(
+            _mm_cmpeq_epi8(data, stop1V), _mm_cmpeq_epi8(data, stop2V)),
+        _mm_or_si128(_mm_cmpeq_epi8(data, lf), _mm_cmpeq_epi8(data, cr)));
+    special = _mm_or_si128(special, _mm_cmpeq_epi8(data, zero));
+    // movemask of the data itself yields the high bit of every byte, which is
+    // set exactly for the non-ASCII bytes.
+    unsigned mask = static_cast<unsigned>(_mm_movemask_epi8(special)) |
+        static_cast<unsigned>(_mm_movemask_epi8(data));
+    if (mask)
+      return cur + llvh::countTrailingZeros(mask);
+    cur += 16;
+  }
+#endif
+
+  // Scalar tail.
+  while (cur != end && !isSpecialChar(*cur, stop1, stop2))
+    ++cur;
+  return cur;
+}
+
+const uint8_t *scanASCII(const uint8_t *cur, const uint8_t *end) {
+  assert(cur <= end && "cur must be <= end");
+
+#ifdef HERMES_SIMD_NEON
+  while (end - cur >= 16) {
+    uint8x16_t data = vld1q_u8(cur);
+    // Most input is entirely ASCII, so first check the whole vector at once.
+    if (vmaxvq_u8(data) >= 0x80) {
+      uint64_t mask = nibbleMask(vcgeq_u8(data, vdupq_n_u8(0x80)));
+      return cur + llvh::countTrailingZeros(mask) / 4;
+    }
+    cur += 16;
+  }
+#elif defined(HERMES_SIMD_SSE2)
+  while (end - cur >= 16) {
+    __m128i data = _mm_loadu_si128(reinterpret_cast<const __m128i *>(cur));
+    // movemask yields the high bit of every byte.
+    unsigned mask = static_cast<unsigned>(_mm_movemask_epi8(data));
+    if (mask)
+      return cur + llvh::countTrailingZeros(mask);
+    cur += 16;
+  }
+#endif
+
+  // Scalar tail.
+  while (cur != end && *cur < 0x80)
+    ++cur;
+  return cur;
+}
+
+const char *scanUntilJSONEscape(const char *cur, const char *end) {
+  assert(cur <= end && "cur must be <= end");
+
+#ifdef HERMES_SIMD_NEON
+  const uint8x16_t quote = vdupq_n_u8('"');
+  const uint8x16_t backslash = vdupq_n_u8('\\');
+  const uint8x16_t space = vdupq_n_u8(' ');
+  const uint8x16_t nonASCII = vdupq_n_u8(0x80);
+  while (end - cur >= 16) {
+    uint8x16_t data = vld1q_u8(reinterpret_cast<const uint8_t *>(cur));
+    uint8x16_t special = vorrq_u8(
+        vorrq_u8(vceqq_u8(data, quote), vceqq_u8(data, backslash)),
+        vorrq_u8(vcltq_u8(data, space), vcgeq_u8(data, nonASCII)));
+    uint64_t mask = nibbleMask(special);
+    if (mask)
+      return cur + llvh::countTrailingZeros(mask) / 4;
+    cur += 16;
+  }
+#elif defined(HERMES_SIMD_SSE2)
+  const __m128i quote = _mm_set1_epi8('"');
+  const __m128i backslash = _mm_set1_epi8('\\');
+  const __m128i space = _mm_set1_epi8(' ');
+  while (end - cur >= 16) {
+    __m128i data = _mm_loadu_si128(reinterpret_cast<const __m128i *>(cur));
+    // The signed comparison with ' ' also catches the non-ASCII bytes.
+    __m128i special = _mm_or_si128(
+        _mm_or_si128(
+            _mm_cmpeq_epi8(data, quote), _mm_cmpeq_epi8(data, backslash)),
+        _mm_cmplt_epi8(data, space));
+    unsigned mask = static_cast<unsigned>(_mm_movemask_epi8(special));
+    if (mask)
+      return cur + llvh::countTrailingZeros(mask);
+    cur += 16;
+  }
+#endif
+
+  // Scalar tail.
+  while (cur != end && !isJSONEscapeChar(*cur))
+    ++cur;
+  return cur;
+}
+
+} // namespace hermes
@@ -162,6 +162,13 @@ void vm_prefetch(void *p, size_t sz) {
       "Precondition: pointer is page-aligned.");
 }
 
+void vm_populate(void *p, size_t sz) {
+  // Linear memory is always resident, so there is nothing to fault in.
+  assert(
+      reinterpret_cast<intptr_t>(p) % page_size() == 0 &&
+      "Precondition: pointer is page-aligned.");
+}
+
 void vm_name(void *p, size_t sz, const char *name) {}
 
 bool vm_protect(void *p, size_t sz, ProtectMode mode) {
@@ -296,6 +296,26 @@ void vm_prefetch(void *p, size_t sz) {
   madvise(p, sz, MADV_WILLNEED);
 }
 
+void vm_populate(void *p, size_t sz) {
+  const size_t PS = page_size();
+  assert(
+      reinterpret_cast<intptr_t>(p) % PS == 0 &&
+      "Precondition: pointer is page-aligned.");
+
+#if defined(__linux__) && defined(MADV_POPULATE_WRITE)
+  // Linux 5.14+ can fault in the whole range with a single call.
+  if (madvise(p, sz, MADV_POPULATE_WRITE) == 0)
+    return;
+#endif
+  // Write to one byte of each page. Writing back the value that is already
+  // there leaves the contents unchanged.
+  char *end = static_cast<char *>(p) + sz;
+  for (char *cur = static_cast<char *>(p); cur < end; cur += PS) {
+    volatile char *byte = cur;
+    *byte = *byte;
+  }
+}
+
 void vm_name(void *p, size_t sz, const char *name) {
 #ifdef __ANDROID__
   prctl(PR_SET_VMA, PR_SET_VMA_ANON_NAME, p, sz, name);
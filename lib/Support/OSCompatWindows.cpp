@@ -319,6 +319,21 @@ void vm_prefetch(void *p, size_t sz) {
   PrefetchVirtualMemory(GetCurrentProcess(), 1, &entry, 0);
 }
 
+void vm_populate(void *p, size_t sz) {
+  const size_t PS = page_size();
+  assert(
+      reinterpret_cast<intptr_t>(p) % PS == 0 &&
+      "Precondition: pointer is page-aligned.");
+
+  // Write to one byte of each page. Writing back the value that is already
+  // there leaves the contents unchanged.
+  char *end = static_cast<char *>(p) + sz;
+  for (char *cur = static_cast<char *>(p); cur < end; cur += PS) {
+    volatile char *byte = cur;
+    *byte = *byte;
+  }
+}
+
 void vm_name(void *p, size_t sz, const char *name) {
   (void)p;
   (void)sz;
@@ -16,6 +16,7 @@
 #include "hermes/VM/JSError.h"
 #include "hermes/VM/JSMapImpl.h"
 #include "hermes/VM/JSNativeFunctions.h"
+#include "hermes/VM/JSPromise.h"
 #include "hermes/VM/JSProxy.h"
 #include "hermes/VM/JSRegExp.h"
 #include "hermes/VM/JSTypedArray.h"
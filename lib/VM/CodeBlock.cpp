@@ -362,6 +362,12 @@ void CodeBlock::installBreakpointAtOffset(uint32_t offset) {
       sizeof(inst::DebuggerInst) == 1,
       "debugger instruction can only be a single opcode atom");
 
+  if (numInstalledBreakpoints_ == 0) {
+    // There are no breakpoints yet, so the opcode array is unpatched.
+    originalOpcodes_.reset(new hbc::opcode_atom_t[opcodes.size()]);
+    std::copy(opcodes.begin(), opcodes.end(), originalOpcodes_.get());
+  }
+
   makeWritable(address, sizeof(inst::DebuggerInst));
   *address = debuggerOpcode;
   ++numInstalledBreakpoints_;
@@ -378,10 +384,16 @@ void CodeBlock::uninstallBreakpointAtOffset(
       *address == static_cast<hbc::opcode_atom_t>(OpCode::Debugger) &&
       "can't uninstall a non-debugger instruction");
 
+  assert(
+      originalOpcodes_ && originalOpcodes_[offset] == opCode &&
+      "uninstalled opcode doesn't match the original one");
+
   // This is valid because we can only uninstall breakpoints that we installed.
   // Therefore, the page here must be writable.
   *address = opCode;
-  --numInstalledBreakpoints_;
+  if (--numInstalledBreakpoints_ == 0) {
+    originalOpcodes_.reset();
+  }
 }
 
 #endif
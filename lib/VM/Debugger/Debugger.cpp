@@ -108,17 +108,7 @@ void Debugger::breakAtPossibleNextInstructions(const InterpreterState &state) {
 }
 
 inst::OpCode Debugger::getRealOpCode(CodeBlock *block, uint32_t offset) const {
-  auto breakpointOpt = getBreakpointLocation(block, offset);
-  if (breakpointOpt) {
-    const auto *inst =
-        reinterpret_cast<const inst::Inst *>(&(breakpointOpt->opCode));
-    return inst->opCode;
-  }
-
-  auto opcodes = block->getOpcodeArray();
-  assert(offset < opcodes.size() && "opCode offset out of bounds");
-  const auto *inst = reinterpret_cast<const inst::Inst *>(&opcodes[offset]);
-  return inst->opCode;
+  return block->getRealOpCode(offset);
 }
 
 ExecutionStatus Debugger::runDebugger(
@@ -125,6 +125,7 @@ void HiddenClassBuildMeta(const GCCell *cell, Metadata::Builder &mb) {
   mb.addField("parent", &self->parent_);
   mb.addField("propertyMap", &self->propertyMap_);
   mb.addField("forInCache", &self->forInCache_);
+  mb.addField("jsonStringifyCache", &self->jsonStringifyCache_);
 }
 
 void HiddenClass::_finalizeImpl(GCCell *cell, GC &gc) {
@@ -1448,13 +1448,12 @@ tailCall:
         O1REG(Call) = res.getValue();
 
 #ifdef HERMES_ENABLE_DEBUGGER
-        // Only do the more expensive check for breakpoint location (in
-        // getRealOpCode) if there are breakpoints installed in the function
-        // we're returning into.
+        // The call instruction may have been patched with a breakpoint if
+        // there are breakpoints installed in the function we're returning
+        // into.
         if (LLVM_UNLIKELY(curCodeBlock->getNumInstalledBreakpoints() > 0)) {
           ip = IPADD(
-              inst::getInstSize(
-                  runtime.debugger_.getRealOpCode(curCodeBlock, CUROFFSET)));
+              inst::getInstSize(curCodeBlock->getRealOpCode(CUROFFSET)));
         } else {
           // No breakpoints in the function being returned to, just use
           // nextInstCall().
@@ -1594,6 +1593,12 @@ tailCall:
               goto exception;
             }
           }
+          if (runtime.testAndClearYieldAsyncBreakRequest()) {
+            CAPTURE_IP_ASSIGN(auto yRes, runtime.notifyYield());
+            if (yRes == ExecutionStatus::EXCEPTION) {
+              goto exception;
+            }
+          }
         }
         gcScope.flushToSmallCount(KEEP_HANDLES);
 
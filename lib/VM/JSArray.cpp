@@ -865,16 +865,34 @@ PseudoHandle<JSArrayIterator> JSArrayIterator::create(
 CallResult<HermesValue> JSArrayIterator::nextElement(
     Handle<JSArrayIterator> self,
     Runtime &runtime) {
-  if (!self->iteratedObject_) {
+  struct : Locals {
+    PinnedValue<> value;
+  } lv;
+  LocalsRAII lraii{runtime, &lv};
+
+  CallResult<bool> nextRes = nextValue(self, runtime, &lv.value);
+  if (LLVM_UNLIKELY(nextRes == ExecutionStatus::EXCEPTION)) {
+    return ExecutionStatus::EXCEPTION;
+  }
+  if (!*nextRes) {
     // 5. If a is undefined, return CreateIterResultObject(undefined, true).
     return createIterResultObject(runtime, Runtime::getUndefinedValue(), true)
         .getHermesValue();
   }
+  return createIterResultObject(runtime, lv.value, false).getHermesValue();
+}
+
+CallResult<bool> JSArrayIterator::nextValue(
+    Handle<JSArrayIterator> self,
+    Runtime &runtime,
+    PinnedValue<> *value) {
+  if (!self->iteratedObject_) {
+    return false;
+  }
 
   struct : Locals {
     PinnedValue<JSObject> a;
     PinnedValue<> index;
-    PinnedValue<> value;
     PinnedValue<JSArray> arr;
   } lv;
   LocalsRAII lraii{runtime, &lv};
@@ -917,8 +935,7 @@ CallResult<HermesValue> JSArrayIterator::nextElement(
     // undefined.
     self->iteratedObject_.setNull(runtime.getHeap());
     // b. Return CreateIterResultObject(undefined, true).
-    return createIterResultObject(runtime, Runtime::getUndefinedValue(), true)
-        .getHermesValue();
+    return false;
   }
 
   // 11. Set the value of the [[ArrayIteratorNextIndex]] internal slot of O to
@@ -929,7 +946,8 @@ CallResult<HermesValue> JSArrayIterator::nextElement(
 
   if (self->iterationKind_ == IterationKind::Key) {
     // 12. If itemKind is "key", return CreateIterResultObject(index, false).
-    return createIterResultObject(runtime, lv.index, false).getHermesValue();
+    *value = lv.index;
+    return true;
   }
 
   // 13. Let elementKey be ToString(index).
@@ -938,15 +956,15 @@ CallResult<HermesValue> JSArrayIterator::nextElement(
   if (LLVM_UNLIKELY(valueRes == ExecutionStatus::EXCEPTION)) {
     return ExecutionStatus::EXCEPTION;
   }
-  lv.value = valueRes->getHermesValue();
+  *value = valueRes->getHermesValue();
 
   switch (self->iterationKind_) {
     case IterationKind::Key:
       llvm_unreachable("Early return already occurred in Key case");
-      return HermesValue::encodeEmptyValue();
+      return false;
     case IterationKind::Value:
       // 16. If itemKind is "value", let result be elementValue.
-      return createIterResultObject(runtime, lv.value, false).getHermesValue();
+      return true;
     case IterationKind::Entry: {
       // 17. b. Let result be CreateArrayFromList(«index, elementValue»).
       auto resultRes = JSArray::create(runtime, 2, 2);
@@ -959,19 +977,20 @@ CallResult<HermesValue> JSArrayIterator::nextElement(
               ExecutionStatus::EXCEPTION))
         return ExecutionStatus::EXCEPTION;
       if (LLVM_UNLIKELY(
-              JSArray::setElementAt(lv.arr, runtime, 1, lv.value) ==
+              JSArray::setElementAt(lv.arr, runtime, 1, *value) ==
               ExecutionStatus::EXCEPTION))
         return ExecutionStatus::EXCEPTION;
       // 18. Return CreateIterResultObject(result, false).
-      return createIterResultObject(runtime, lv.arr, false).getHermesValue();
+      *value = lv.arr.getHermesValue();
+      return true;
     }
     case IterationKind::NumKinds:
       llvm_unreachable("Invalid iteration kind");
-      return HermesValue::encodeEmptyValue();
+      return false;
   }
 
   llvm_unreachable("Invalid iteration kind");
-  return HermesValue::encodeEmptyValue();
+  return false;
 }
 
 } // namespace vm
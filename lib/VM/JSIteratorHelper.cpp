@@ -0,0 +1,444 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include "hermes/VM/JSIteratorHelper.h"
+
+#include "hermes/VM/BuildMetadata.h"
+#include "hermes/VM/JSArray.h"
+#include "hermes/VM/JSNativeFunctions.h"
+#include "hermes/VM/Operations.h"
+
+namespace hermes {
+namespace vm {
+
+//===----------------------------------------------------------------------===//
+// class JSIteratorHelper
+
+const ObjectVTable JSIteratorHelper::vt{
+    VTable(CellKind::JSIteratorHelperKind, cellSize<JSIteratorHelper>()),
+    JSIteratorHelper::_getOwnIndexedRangeImpl,
+    JSIteratorHelper::_haveOwnIndexedImpl,
+    JSIteratorHelper::_getOwnIndexedPropertyFlagsImpl,
+    JSIteratorHelper::_getOwnIndexedImpl,
+    JSIteratorHelper::_setOwnIndexedImpl,
+    JSIteratorHelper::_deleteOwnIndexedImpl,
+    JSIteratorHelper::_checkAllOwnIndexedImpl,
+};
+
+void JSIteratorHelperBuildMeta(const GCCell *cell, Metadata::Builder &mb) {
+  mb.addJSObjectOverlapSlots(JSObject::numOverlapSlots<JSIteratorHelper>());
+  JSObjectBuildMeta(cell, mb);
+  const auto *self = static_cast<const JSIteratorHelper *>(cell);
+  mb.setVTable(&JSIteratorHelper::vt);
+  mb.addField("iterated", &self->iterated_);
+  mb.addField("nextMethod", &self->nextMethod_);
+  mb.addField("fn", &self->fn_);
+  mb.addField("inner", &self->inner_);
+  mb.addField("innerNextMethod", &self->innerNextMethod_);
+}
+
+PseudoHandle<JSIteratorHelper> JSIteratorHelper::create(
+    Runtime &runtime,
+    Kind kind,
+    Handle<JSObject> iterated,
+    Handle<> nextMethod,
+    Handle<Callable> fn,
+    double limit) {
+  auto proto = Handle<JSObject>::vmcast(&runtime.iteratorHelperPrototype);
+
+  auto *cell = runtime.makeAFixed<JSIteratorHelper>(
+      runtime,
+      proto,
+      runtime.getHiddenClassForPrototype(
+          *proto, numOverlapSlots<JSIteratorHelper>()),
+      kind,
+      iterated,
+      nextMethod,
+      fn,
+      limit);
+  return JSObjectInit::initToPseudoHandle(runtime, cell);
+}
+
+CallResult<bool> JSIteratorHelper::step(
+    Handle<JSIteratorHelper> self,
+    Runtime &runtime,
+    PinnedValue<> *value) {
+  // GeneratorValidate.
+  if (LLVM_UNLIKELY(self->state_ == State::Running)) {
+    return runtime.raiseTypeError("Iterator Helper is already running");
+  }
+  if (self->state_ == State::Done) {
+    return false;
+  }
+
+  self->state_ = State::Running;
+  CallResult<bool> res = run(self, runtime, value);
+  if (LLVM_UNLIKELY(res == ExecutionStatus::EXCEPTION) || !*res) {
+    // The closure threw or returned, which completes the generator.
+    self->state_ = State::Done;
+    self->inner_.setNull(runtime.getHeap());
+    return res;
+  }
+  self->state_ = State::SuspendedYield;
+  return true;
+}
+
+CallResult<bool> JSIteratorHelper::run(
+    Handle<JSIteratorHelper> self,
+    Runtime &runtime,
+    PinnedValue<> *value) {
+  struct : public Locals {
+    PinnedValue<JSObject> iterated;
+    PinnedValue<> nextMethod;
+    PinnedValue<Callable> fn;
+    PinnedValue<> mapped;
+    PinnedValue<JSObject> inner;
+    PinnedValue<> innerNextMethod;
+  } lv;
+  LocalsRAII lraii(runtime, &lv);
+  lv.iterated = self->iterated_.getNonNull(runtime);
+  lv.nextMethod = self->nextMethod_;
+  lv.fn = self->fn_.get(runtime);
+
+  switch (self->kind_) {
+    case Kind::Map: {
+      // ES2025 27.1.4.8 Iterator.prototype.map ( mapper ) 6.b
+      // i. Let value be ? IteratorStepValue(iterated).
+      // ii. If value is done, return ReturnCompletion(undefined).
+      auto stepRes =
+          iteratorStepValueDirect(runtime, lv.iterated, lv.nextMethod, value);
+      if (LLVM_UNLIKELY(stepRes == ExecutionStatus::EXCEPTION) || !*stepRes)
+        return stepRes;
+      // iii. Let mapped be Completion(Call(mapper, undefined, « value,
+      //      𝔽(counter) »)).
+      // iv. IfAbruptCloseIterator(mapped, iterated).
+      auto mappedRes = Callable::executeCall2(
+          lv.fn,
+          runtime,
+          Runtime::getUndefinedValue(),
+          value->getHermesValue(),
+          HermesValue::encodeTrustedNumberValue(self->counter_));
+      if (LLVM_UNLIKELY(mappedRes == ExecutionStatus::EXCEPTION))
+        return iteratorCloseAndRethrow(runtime, lv.iterated);
+      // vi. Let completion be Completion(Yield(mapped)).
+      // viii. Set counter to counter + 1.
+      self->counter_ += 1;
+      *value = std::move(*mappedRes);
+      return true;
+    }
+
+    case Kind::Filter:
+      // ES2025 27.1.4.4 Iterator.prototype.filter ( predicate ) 6.b
+      for (GCScopeMarkerRAII marker{runtime};; marker.flush()) {
+        // i. Let value be ? IteratorStepValue(iterated).
+        // ii. If value is done, return ReturnCompletion(undefined).
+        auto stepRes =
+            iteratorStepValueDirect(runtime, lv.iterated, lv.nextMethod, value);
+        if (LLVM_UNLIKELY(stepRes == ExecutionStatus::EXCEPTION) || !*stepRes)
+          return stepRes;
+        // iii. Let selected be Completion(Call(predicate, undefined, « value,
+        //      𝔽(counter) »)).
+        // iv. IfAbruptCloseIterator(selected, iterated).
+        auto selectedRes = Callable::executeCall2(
+            lv.fn,
+            runtime,
+            Runtime::getUndefinedValue(),
+            value->getHermesValue(),
+            HermesValue::encodeTrustedNumberValue(self->counter_));
+        if (LLVM_UNLIKELY(selectedRes == ExecutionStatus::EXCEPTION))
+          return iteratorCloseAndRethrow(runtime, lv.iterated);
+        // vi. Set counter to counter + 1.
+        self->counter_ += 1;
+        // v. If ToBoolean(selected) is true, then yield value.
+        if (toBoolean(selectedRes->get()))
+          return true;
+      }
+
+    case Kind::Take:
+      // ES2025 27.1.4.11 Iterator.prototype.take ( limit ) 9.b
+      // i. If remaining = 0, then
+      if (self->remaining_ == 0) {
+        // 1. Return ? IteratorClose(iterated, ReturnCompletion(undefined)).
+        if (LLVM_UNLIKELY(
+                iteratorClose(
+                    runtime, lv.iterated, Runtime::getEmptyValue()) ==
+                ExecutionStatus::EXCEPTION))
+          return ExecutionStatus::EXCEPTION;
+        return false;
+      }
+      // ii. If remaining ≠ +∞, set remaining to remaining - 1.
+      if (self->remaining_ != std::numeric_limits<double>::infinity())
+        self->remaining_ -= 1;
+      // iii. Let value be ? IteratorStepValue(iterated).
+      // iv. If value is done, return ReturnCompletion(undefined).
+      // v. Let completion be Completion(Yield(value)).
+      return iteratorStepValueDirect(
+          runtime, lv.iterated, lv.nextMethod, value);
+
+    case Kind::Drop:
+      // ES2025 27.1.4.2 Iterator.prototype.drop ( limit ) 10.b
+      // Repeat, while remaining > 0,
+      for (GCScopeMarkerRAII marker{runtime}; self->remaining_ > 0;
+           marker.flush()) {
+        // i. If remaining ≠ +∞, set remaining to remaining - 1.
+        if (self->remaining_ != std::numeric_limits<double>::infinity())
+          self->remaining_ -= 1;
+        // ii. Let next be ? IteratorStep(iterated).
+        // iii. If next is done, return ReturnCompletion(undefined).
+        auto stepRes = iteratorStepValueDirect(
+            runtime, lv.iterated, lv.nextMethod, nullptr);
+        if (LLVM_UNLIKELY(stepRes == ExecutionStatus::EXCEPTION) || !*stepRes)
+          return stepRes;
+      }
+      // c. Repeat,
+      // i. Let value be ? IteratorStepValue(iterated).
+      // ii. If value is done, return ReturnCompletion(undefined).
+      // iii. Let completion be Completion(Yield(value)).
+      return iteratorStepValueDirect(
+          runtime, lv.iterated, lv.nextMethod, value);
+
+    case Kind::FlatMap:
+      // ES2025 27.1.4.6 Iterator.prototype.flatMap ( mapper ) 5.b
+      for (GCScopeMarkerRAII marker{runtime};; marker.flush()) {
+        if (!self->inner_) {
+          // i. Let value be ? IteratorStepValue(iterated).
+          // ii. If value is done, return ReturnCompletion(undefined).
+          auto stepRes = iteratorStepValueDirect(
+              runtime, lv.iterated, lv.nextMethod, value);
+          if (LLVM_UNLIKELY(stepRes == ExecutionStatus::EXCEPTION) ||
+              !*stepRes)
+            return stepRes;
+          // iii. Let mapped be Completion(Call(mapper, undefined, « value,
+          //      𝔽(counter) »)).
+          // iv. IfAbruptCloseIterator(mapped, iterated).
+          auto mappedRes = Callable::executeCall2(
+              lv.fn,
+              runtime,
+              Runtime::getUndefinedValue(),
+              value->getHermesValue(),
+              HermesValue::encodeTrustedNumberValue(self->counter_));
+          if (LLVM_UNLIKELY(mappedRes == ExecutionStatus::EXCEPTION))
+            return iteratorCloseAndRethrow(runtime, lv.iterated);
+          lv.mapped = std::move(*mappedRes);
+          // v. Let innerIterator be Completion(GetIteratorFlattenable(mapped,
+          //    reject-primitives)).
+          // vi. IfAbruptCloseIterator(innerIterator, iterated).
+          auto innerRes = getIteratorFlattenable(
+              runtime, lv.mapped, PrimitiveHandling::RejectPrimitives);
+          if (LLVM_UNLIKELY(innerRes == ExecutionStatus::EXCEPTION))
+            return iteratorCloseAndRethrow(runtime, lv.iterated);
+          self->inner_.setNonNull(
+              runtime, innerRes->iterator.get(), runtime.getHeap());
+          self->innerNextMethod_.set(*innerRes->nextMethod, runtime.getHeap());
+          // x. Set counter to counter + 1.
+          self->counter_ += 1;
+        }
+        // ix. Repeat, while innerAlive is true,
+        lv.inner = self->inner_.getNonNull(runtime);
+        lv.innerNextMethod = self->innerNextMethod_;
+        // 1. Let innerValue be Completion(IteratorStepValue(innerIterator)).
+        auto innerStepRes = iteratorStepValueDirect(
+            runtime, lv.inner, lv.innerNextMethod, value);
+        // 2. IfAbruptCloseIterator(innerValue, iterated).
+        if (LLVM_UNLIKELY(innerStepRes == ExecutionStatus::EXCEPTION)) {
+          self->inner_.setNull(runtime.getHeap());
+          return iteratorCloseAndRethrow(runtime, lv.iterated);
+        }
+        // 3. If innerValue is done, set innerAlive to false.
+        if (!*innerStepRes) {
+          self->inner_.setNull(runtime.getHeap());
+          continue;
+        }
+        // 4. Else, let completion be Completion(Yield(innerValue)).
+        return true;
+      }
+  }
+  llvm_unreachable("Invalid iterator helper kind");
+}
+
+CallResult<HermesValue> JSIteratorHelper::next(
+    Handle<JSIteratorHelper> self,
+    Runtime &runtime) {
+  struct : public Locals {
+    PinnedValue<> value;
+  } lv;
+  LocalsRAII lraii(runtime, &lv);
+  CallResult<bool> stepRes = step(self, runtime, &lv.value);
+  if (LLVM_UNLIKELY(stepRes == ExecutionStatus::EXCEPTION)) {
+    return ExecutionStatus::EXCEPTION;
+  }
+  if (!*stepRes) {
+    return createIterResultObject(runtime, Runtime::getUndefinedValue(), true)
+        .getHermesValue();
+  }
+  return createIterResultObject(runtime, lv.value, false).getHermesValue();
+}
+
+CallResult<HermesValue> JSIteratorHelper::returnImpl(
+    Handle<JSIteratorHelper> self,
+    Runtime &runtime) {
+  struct : public Locals {
+    PinnedValue<JSObject> iterated;
+    PinnedValue<JSObject> inner;
+  } lv;
+  LocalsRAII lraii(runtime, &lv);
+
+  switch (self->state_) {
+    case State::SuspendedStart:
+      // 4. If O.[[GeneratorState]] is suspended-start, then
+      // a. Set O.[[GeneratorState]] to completed.
+      self->state_ = State::Done;
+      // c. Perform ? IteratorCloseAll(O.[[UnderlyingIterators]],
+      //    ReturnCompletion(undefined)).
+      lv.iterated = self->iterated_.getNonNull(runtime);
+      if (LLVM_UNLIKELY(
+              iteratorClose(runtime, lv.iterated, Runtime::getEmptyValue()) ==
+              ExecutionStatus::EXCEPTION))
+        return ExecutionStatus::EXCEPTION;
+      break;
+
+    case State::SuspendedYield: {
+      // 6. Return ? GeneratorResumeAbrupt(O, C, "Iterator Helper").
+      // The closure resumes with a return completion at its yield, and closes
+      // the iterators it is iterating.
+      self->state_ = State::Running;
+      lv.iterated = self->iterated_.getNonNull(runtime);
+      lv.inner = self->inner_.get(runtime);
+      self->inner_.setNull(runtime.getHeap());
+      ExecutionStatus status = ExecutionStatus::RETURNED;
+      if (*lv.inner) {
+        // Let backupCompletion be Completion(IteratorClose(innerIterator,
+        // completion)).
+        // IfAbruptCloseIterator(backupCompletion, iterated).
+        if (LLVM_UNLIKELY(
+                iteratorClose(runtime, lv.inner, Runtime::getEmptyValue()) ==
+                ExecutionStatus::EXCEPTION))
+          status = iteratorCloseAndRethrow(runtime, lv.iterated);
+      }
+      // Return ? IteratorClose(iterated, completion).
+      if (status == ExecutionStatus::RETURNED)
+        status =
+            iteratorClose(runtime, lv.iterated, Runtime::getEmptyValue());
+      self->state_ = State::Done;
+      if (LLVM_UNLIKELY(status == ExecutionStatus::EXCEPTION))
+        return ExecutionStatus::EXCEPTION;
+      break;
+    }
+
+    case State::Running:
+      return runtime.raiseTypeError("Iterator Helper is already running");
+
+    case State::Done:
+      break;
+  }
+  return createIterResultObject(runtime, Runtime::getUndefinedValue(), true)
+      .getHermesValue();
+}
+
+//===----------------------------------------------------------------------===//
+// class JSWrapForValidIterator
+
+const ObjectVTable JSWrapForValidIterator::vt{
+    VTable(
+        CellKind::JSWrapForValidIteratorKind,
+        cellSize<JSWrapForValidIterator>()),
+    JSWrapForValidIterator::_getOwnIndexedRangeImpl,
+    JSWrapForValidIterator::_haveOwnIndexedImpl,
+    JSWrapForValidIterator::_getOwnIndexedPropertyFlagsImpl,
+    JSWrapForValidIterator::_getOwnIndexedImpl,
+    JSWrapForValidIterator::_setOwnIndexedImpl,
+    JSWrapForValidIterator::_deleteOwnIndexedImpl,
+    JSWrapForValidIterator::_checkAllOwnIndexedImpl,
+};
+
+void JSWrapForValidIteratorBuildMeta(
+    const GCCell *cell,
+    Metadata::Builder &mb) {
+  mb.addJSObjectOverlapSlots(
+      JSObject::numOverlapSlots<JSWrapForValidIterator>());
+  JSObjectBuildMeta(cell, mb);
+  const auto *self = static_cast<const JSWrapForValidIterator *>(cell);
+  mb.setVTable(&JSWrapForValidIterator::vt);
+  mb.addField("iterated", &self->iterated_);
+  mb.addField("nextMethod", &self->nextMethod_);
+}
+
+PseudoHandle<JSWrapForValidIterator> JSWrapForValidIterator::create(
+    Runtime &runtime,
+    Handle<JSObject> iterated,
+    Handle<> nextMethod) {
+  auto proto =
+      Handle<JSObject>::vmcast(&runtime.wrapForValidIteratorPrototype);
+
+  auto *cell = runtime.makeAFixed<JSWrapForValidIterator>(
+      runtime,
+      proto,
+      runtime.getHiddenClassForPrototype(
+          *proto, numOverlapSlots<JSWrapForValidIterator>()),
+      iterated,
+      nextMethod);
+  return JSObjectInit::initToPseudoHandle(runtime, cell);
+}
+
+//===----------------------------------------------------------------------===//
+
+CallResult<bool> iteratorStepValueDirect(
+    Runtime &runtime,
+    Handle<JSObject> iterator,
+    Handle<> nextMethod,
+    PinnedValue<> *value) {
+  if (auto *next = dyn_vmcast<NativeFunction>(*nextMethod)) {
+    // Calling the original next method of these iterators is not observable
+    // beyond what stepping them directly does, and allocates a result object
+    // for every value.
+    if (next->getFunctionPtr() == arrayIteratorPrototypeNext &&
+        vmisa<JSArrayIterator>(*iterator)) {
+      struct : public Locals {
+        PinnedValue<> ignored;
+      } lv;
+      LocalsRAII lraii(runtime, &lv);
+      return JSArrayIterator::nextValue(
+          Handle<JSArrayIterator>::vmcast(iterator),
+          runtime,
+          value ? value : &lv.ignored);
+    }
+    if (next->getFunctionPtr() == iteratorHelperPrototypeNext &&
+        vmisa<JSIteratorHelper>(*iterator)) {
+      // Chained helpers step each other recursively on the native stack.
+      ScopedNativeDepthTracker depthTracker{runtime};
+      if (LLVM_UNLIKELY(depthTracker.overflowed())) {
+        return runtime.raiseStackOverflow(
+            Runtime::StackOverflowKind::NativeStack);
+      }
+      struct : public Locals {
+        PinnedValue<> ignored;
+      } lv;
+      LocalsRAII lraii(runtime, &lv);
+      return JSIteratorHelper::step(
+          Handle<JSIteratorHelper>::vmcast(iterator),
+          runtime,
+          value ? value : &lv.ignored);
+    }
+  }
+
+  if (LLVM_UNLIKELY(!vmisa<Callable>(*nextMethod))) {
+    return runtime.raiseTypeError("'next' method on iterator must be callable");
+  }
+  CheckedIteratorRecord iteratorRecord{
+      iterator, Handle<Callable>::vmcast(nextMethod)};
+  if (!value) {
+    auto stepRes = iteratorStep(runtime, iteratorRecord);
+    if (LLVM_UNLIKELY(stepRes == ExecutionStatus::EXCEPTION)) {
+      return ExecutionStatus::EXCEPTION;
+    }
+    return static_cast<bool>(*stepRes);
+  }
+  return iteratorStepValue(runtime, iteratorRecord, value);
+}
+
+} // namespace vm
+} // namespace hermes
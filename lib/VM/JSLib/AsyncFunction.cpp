@@ -7,10 +7,16 @@
 
 //===----------------------------------------------------------------------===//
 /// \file
-/// ES12 26.7.1 The AsyncFunction constructor.
+/// ES12 26.7.1 The AsyncFunction constructor, and the native driver of async
+/// functions.
 //===----------------------------------------------------------------------===//
 #include "JSLibInternal.h"
 
+#include "hermes/BCGen/GeneratorResumeMethod.h"
+#include "hermes/VM/JSGeneratorObject.h"
+#include "hermes/VM/JSPromise.h"
+#include "hermes/VM/StackFrame-inline.h"
+
 namespace hermes {
 namespace vm {
 
@@ -81,5 +87,284 @@ HermesValue createAsyncFunctionConstructor(Runtime &runtime) {
   return lv.cons.getHermesValue();
 }
 
+//===----------------------------------------------------------------------===//
+// An async function is compiled to an outer function which passes its body,
+// as an inner generator, to the spawnAsync builtin. When the native Promise is
+// available, spawnAsync is implemented here rather than in InternalJavaScript:
+// the inner generator function is resumed directly instead of through
+// %GeneratorPrototype%.next, and each await performs PerformPromiseThen
+// without a derived promise, reusing the same two continuation functions for
+// every await of a call.
+//===----------------------------------------------------------------------===//
+
+namespace {
+
+/// Additional slots of the continuation functions.
+enum AsyncContinuationSlot {
+  /// The inner function of the generator running the async function body.
+  AsyncInnerFunction,
+  /// The promise returned by the async function.
+  AsyncPromise,
+  /// The other continuation function.
+  AsyncSibling,
+  AsyncSlotCount
+};
+
+/// Create a continuation function of the async function whose body is run by
+/// \p innerFunc and which returned \p promise.
+PseudoHandle<NativeFunction> createAsyncContinuation(
+    Runtime &runtime,
+    NativeFunctionPtr functionPtr,
+    Handle<Callable> innerFunc,
+    Handle<JSPromise> promise) {
+  auto fn = NativeFunction::create(
+      runtime,
+      Handle<JSObject>::vmcast(&runtime.functionPrototype),
+      Runtime::makeNullHandle<Environment>(),
+      nullptr,
+      functionPtr,
+      Predefined::getSymbolID(Predefined::emptyString),
+      1,
+      Runtime::makeNullHandle<JSObject>(),
+      AsyncSlotCount);
+  NativeFunction::setAdditionalSlotValue(
+      *fn,
+      runtime,
+      AsyncInnerFunction,
+      SmallHermesValue::encodeObjectValue(*innerFunc, runtime));
+  NativeFunction::setAdditionalSlotValue(
+      *fn,
+      runtime,
+      AsyncPromise,
+      SmallHermesValue::encodeObjectValue(*promise, runtime));
+  NativeFunction::setAdditionalSlotValue(
+      *fn, runtime, AsyncSibling, SmallHermesValue::encodeUndefinedValue());
+  return createPseudoHandle(*fn);
+}
+
+/// Resume the async function whose body is run by \p innerFunc with
+/// \p action and \p value. When the body completes, settle \p promise with
+/// its completion. When it awaits a value, ES2024 27.7.5.3 Await: register
+/// \p onFulfilled and \p onRejected on the promise of that value, creating
+/// them the first time they are needed.
+/// \return EXCEPTION only if an uncatchable error was thrown, or if the
+///   rejection tracker threw.
+ExecutionStatus asyncFunctionStep(
+    Runtime &runtime,
+    Handle<Callable> innerFunc,
+    Handle<JSPromise> promise,
+    MutableHandle<NativeFunction> onFulfilled,
+    MutableHandle<NativeFunction> onRejected,
+    Action action,
+    Handle<> value) {
+  struct : public Locals {
+    PinnedValue<> arg;
+    PinnedValue<JSObject> iterResult;
+    PinnedValue<> result;
+    PinnedValue<JSPromise> awaited;
+  } lv;
+  LocalsRAII lraii(runtime, &lv);
+  lv.arg = *value;
+
+  // The loop only repeats if awaiting throws, which resumes the body with the
+  // thrown value.
+  for (;;) {
+    GCScopeMarkerRAII marker{runtime};
+    auto resultRes = Callable::executeCall2(
+        innerFunc,
+        runtime,
+        innerFunc,
+        HermesValue::encodeTrustedNumberValue((uint8_t)action),
+        lv.arg.getHermesValue());
+    if (LLVM_UNLIKELY(resultRes == ExecutionStatus::EXCEPTION)) {
+      // The body completed abruptly.
+      return JSPromise::rejectCapabilityWithThrownValue(runtime, promise);
+    }
+    assert(
+        (*resultRes)->isObject() &&
+        "inner generator function must return an object");
+    lv.iterResult.castAndSetHermesValue<JSObject>(resultRes->get());
+
+    auto doneRes = JSObject::getNamed_RJS(
+        lv.iterResult, runtime, Predefined::getSymbolID(Predefined::done));
+    if (LLVM_UNLIKELY(doneRes == ExecutionStatus::EXCEPTION))
+      return JSPromise::rejectCapabilityWithThrownValue(runtime, promise);
+    bool done = toBoolean(doneRes->get());
+    auto valueRes = JSObject::getNamed_RJS(
+        lv.iterResult, runtime, Predefined::getSymbolID(Predefined::value));
+    if (LLVM_UNLIKELY(valueRes == ExecutionStatus::EXCEPTION))
+      return JSPromise::rejectCapabilityWithThrownValue(runtime, promise);
+    lv.result = std::move(*valueRes);
+
+    if (done) {
+      // The body returned. The promise is not reachable from any resolving
+      // function, so it can be resolved directly.
+      return JSPromise::resolve(runtime, promise, lv.result);
+    }
+
+    // 2. Let promise be ? PromiseResolve(%Promise%, value).
+    auto pRes = JSPromise::promiseResolve(
+        runtime,
+        Handle<NativeConstructor>(runtime.promiseConstructor),
+        lv.result);
+    if (LLVM_UNLIKELY(pRes == ExecutionStatus::EXCEPTION)) {
+      if (LLVM_UNLIKELY(isUncatchableError(runtime.getThrownValue())))
+        return ExecutionStatus::EXCEPTION;
+      // The await expression throws in the body.
+      lv.arg = runtime.getThrownValue();
+      runtime.clearThrownValue();
+      action = Action::Throw;
+      continue;
+    }
+    lv.awaited.castAndSetHermesValue<JSPromise>(*pRes);
+
+    // 3-6. The continuations resume the body with the settled value.
+    if (!onFulfilled) {
+      onFulfilled = createAsyncContinuation(
+          runtime, asyncFunctionFulfilled, innerFunc, promise);
+      onRejected = createAsyncContinuation(
+          runtime, asyncFunctionRejected, innerFunc, promise);
+      NativeFunction::setAdditionalSlotValue(
+          *onFulfilled,
+          runtime,
+          AsyncSibling,
+          SmallHermesValue::encodeObjectValue(*onRejected, runtime));
+      NativeFunction::setAdditionalSlotValue(
+          *onRejected,
+          runtime,
+          AsyncSibling,
+          SmallHermesValue::encodeObjectValue(*onFulfilled, runtime));
+    }
+
+    // 7. Perform PerformPromiseThen(promise, onFulfilled, onRejected).
+    return JSPromise::performThen(
+        runtime,
+        lv.awaited,
+        onFulfilled,
+        onRejected,
+        Runtime::getUndefinedValue());
+  }
+}
+
+/// Resume the async function of the continuation function being called with
+/// \p action and the settled value of the awaited promise.
+CallResult<HermesValue> asyncFunctionResume(Runtime &runtime, Action action) {
+  NativeArgs args = runtime.getCurrentFrame().getNativeArgs();
+  struct : public Locals {
+    PinnedValue<Callable> innerFunc;
+    PinnedValue<JSPromise> promise;
+    PinnedValue<NativeFunction> self;
+    PinnedValue<NativeFunction> sibling;
+  } lv;
+  LocalsRAII lraii(runtime, &lv);
+
+  NativeFunction *self = vmcast<NativeFunction>(
+      runtime.getCurrentFrame()->getCalleeClosureUnsafe());
+  lv.self = self;
+  lv.innerFunc.castAndSetHermesValue<Callable>(
+      NativeFunction::getAdditionalSlotValue(self, runtime, AsyncInnerFunction)
+          .unboxToHV(runtime));
+  lv.promise.castAndSetHermesValue<JSPromise>(
+      NativeFunction::getAdditionalSlotValue(self, runtime, AsyncPromise)
+          .unboxToHV(runtime));
+  lv.sibling.castAndSetHermesValue<NativeFunction>(
+      NativeFunction::getAdditionalSlotValue(self, runtime, AsyncSibling)
+          .unboxToHV(runtime));
+
+  bool isReject = action == Action::Throw;
+  if (LLVM_UNLIKELY(
+          asyncFunctionStep(
+              runtime,
+              lv.innerFunc,
+              lv.promise,
+              isReject ? lv.sibling : lv.self,
+              isReject ? lv.self : lv.sibling,
+              action,
+              args.getArgHandle(0)) == ExecutionStatus::EXCEPTION)) {
+    return ExecutionStatus::EXCEPTION;
+  }
+  return HermesValue::encodeUndefinedValue();
+}
+
+} // namespace
+
+/// ES2024 27.7.5.3 Await, step 3: resume with the fulfillment value.
+CallResult<HermesValue> asyncFunctionFulfilled(void *, Runtime &runtime) {
+  return asyncFunctionResume(runtime, Action::Next);
+}
+
+/// ES2024 27.7.5.3 Await, step 5: resume by throwing the rejection reason.
+CallResult<HermesValue> asyncFunctionRejected(void *, Runtime &runtime) {
+  return asyncFunctionResume(runtime, Action::Throw);
+}
+
+/// spawnAsync(genF, self, args): start the async function whose body is the
+/// generator function \p genF, applied to \p self and \p args, and return
+/// its promise.
+CallResult<HermesValue> asyncFunctionSpawn(void *, Runtime &runtime) {
+  NativeArgs args = runtime.getCurrentFrame().getNativeArgs();
+  struct : public Locals {
+    PinnedValue<JSPromise> promise;
+    PinnedValue<Callable> innerFunc;
+    PinnedValue<NativeFunction> onFulfilled;
+    PinnedValue<NativeFunction> onRejected;
+  } lv;
+  LocalsRAII lraii(runtime, &lv);
+
+  lv.promise = JSPromise::create(
+      runtime, Handle<JSObject>::vmcast(&runtime.promisePrototype));
+
+  // Create the generator object, which evaluates the parameters.
+  auto genF = args.dyncastArg<Callable>(0);
+  assert(genF && "spawnAsync requires a generator function");
+  CallResult<PseudoHandle<>> genRes{ExecutionStatus::EXCEPTION};
+  if (auto argList = args.dyncastArg<JSObject>(2)) {
+    genRes = Callable::executeCall(
+        genF,
+        runtime,
+        Runtime::getUndefinedValue(),
+        args.getArgHandle(1),
+        argList);
+  } else {
+    genRes = Callable::executeCall0(genF, runtime, args.getArgHandle(1));
+  }
+  if (LLVM_UNLIKELY(genRes == ExecutionStatus::EXCEPTION)) {
+    if (LLVM_UNLIKELY(
+            JSPromise::rejectCapabilityWithThrownValue(runtime, lv.promise) ==
+            ExecutionStatus::EXCEPTION)) {
+      return ExecutionStatus::EXCEPTION;
+    }
+    return lv.promise.getHermesValue();
+  }
+  lv.innerFunc = JSGeneratorObject::getInnerFunction(
+      runtime, vmcast<JSGeneratorObject>(genRes->get()));
+
+  if (LLVM_UNLIKELY(
+          asyncFunctionStep(
+              runtime,
+              lv.innerFunc,
+              lv.promise,
+              lv.onFulfilled,
+              lv.onRejected,
+              Action::Next,
+              Runtime::getUndefinedValue()) == ExecutionStatus::EXCEPTION)) {
+    return ExecutionStatus::EXCEPTION;
+  }
+  return lv.promise.getHermesValue();
+}
+
+void registerAsyncFunctionDriver(Runtime &runtime) {
+  auto fn = NativeFunction::create(
+      runtime,
+      Handle<JSObject>::vmcast(&runtime.functionPrototype),
+      Runtime::makeNullHandle<Environment>(),
+      nullptr,
+      asyncFunctionSpawn,
+      Predefined::getSymbolID(Predefined::spawnAsync),
+      3,
+      Runtime::makeNullHandle<JSObject>());
+  runtime.registerBuiltin(BuiltinMethod::HermesBuiltin_spawnAsync, *fn);
+}
+
 } // namespace vm
 } // namespace hermes
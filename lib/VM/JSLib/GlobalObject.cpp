@@ -527,6 +527,13 @@ void initGlobalObject(Runtime &runtime, const JSLibFlags &jsLibFlags) {
     runtime.weakRefPrototype = JSObject::create(runtime);
   }
 
+  // The native Promise relies on the microtask queue. Without it, the
+  // InternalJavaScript polyfill is used instead.
+  if (LLVM_UNLIKELY(runtime.hasMicrotaskQueue())) {
+    // "Forward declaration" of Promise.prototype.
+    runtime.promisePrototype = JSObject::create(runtime);
+  }
+
   // "Forward declaration" of %ArrayIteratorPrototype%.
   runtime.arrayIteratorPrototype =
       JSObject::create(runtime, runtime.iteratorPrototype);
@@ -539,6 +546,14 @@ void initGlobalObject(Runtime &runtime, const JSLibFlags &jsLibFlags) {
   runtime.regExpStringIteratorPrototype =
       JSObject::create(runtime, runtime.iteratorPrototype);
 
+  // "Forward declaration" of %IteratorHelperPrototype%.
+  runtime.iteratorHelperPrototype =
+      JSObject::create(runtime, runtime.iteratorPrototype);
+
+  // "Forward declaration" of %WrapForValidIteratorPrototype%.
+  runtime.wrapForValidIteratorPrototype =
+      JSObject::create(runtime, runtime.iteratorPrototype);
+
   // "Forward declaration" of "Generator prototype object"
   runtime.generatorPrototype =
       JSObject::create(runtime, runtime.iteratorPrototype);
@@ -645,12 +660,23 @@ void initGlobalObject(Runtime &runtime, const JSLibFlags &jsLibFlags) {
         createWeakRefConstructor(runtime));
   }
 
+  // Only define the native Promise constructor if microtasks are being used.
+  if (LLVM_UNLIKELY(runtime.hasMicrotaskQueue())) {
+    // Promise constructor.
+    runtime.promiseConstructor.castAndSetHermesValue<NativeConstructor>(
+        createPromiseConstructor(runtime));
+  }
+
   // Symbol constructor.
   createSymbolConstructor(runtime);
 
   /// %IteratorPrototype%.
   populateIteratorPrototype(runtime);
 
+  // Iterator constructor, and the iterator helpers.
+  runtime.iteratorConstructor.castAndSetHermesValue<NativeConstructor>(
+      createIteratorConstructor(runtime));
+
   /// Array Iterator.
   populateArrayIteratorPrototype(runtime);
 
@@ -668,6 +694,12 @@ void initGlobalObject(Runtime &runtime, const JSLibFlags &jsLibFlags) {
   runtime.asyncFunctionConstructor.castAndSetHermesValue<NativeConstructor>(
       createAsyncFunctionConstructor(runtime));
 
+  // With the native Promise, async functions are driven natively rather than
+  // by the spawnAsync of InternalJavaScript.
+  if (LLVM_UNLIKELY(runtime.hasMicrotaskQueue())) {
+    registerAsyncFunctionDriver(runtime);
+  }
+
   // %GeneratorPrototype%.
   populateGeneratorPrototype(runtime);
 
@@ -14,6 +14,7 @@
 #include "hermes/VM/JSArray.h"
 #include "hermes/VM/JSArrayBuffer.h"
 #include "hermes/VM/JSLib.h"
+#include "hermes/VM/JSPromise.h"
 #include "hermes/VM/JSTypedArray.h"
 #include "hermes/VM/JSWeakMapImpl.h"
 #include "hermes/VM/Operations.h"
@@ -177,6 +178,14 @@ CallResult<HermesValue> hermesInternalGetInstrumentedStats(
       info.generalStats.usedBefore.max());
   ADD_PROP(
       lv.resultHandle, "js_peakLiveAfterGC", info.generalStats.usedAfter.max());
+  ADD_PROP(
+      lv.resultHandle,
+      "js_regExpCacheHits",
+      runtime.getRegExpCache().getNumHits());
+  ADD_PROP(
+      lv.resultHandle,
+      "js_regExpCacheMisses",
+      runtime.getRegExpCache().getNumMisses());
 
 #if HERMESVM_GCKIND == _HERMESVM_GCVALUE_HADES
   lv.specificStatsHandle = JSObject::create(runtime);
@@ -644,8 +653,64 @@ CallResult<HermesValue> hermesInternalGetFunctionLocation(
   return lv.resultHandle.getHermesValue();
 }
 
+/// \return undefined if the argument is not a native promise. Otherwise, an
+/// object describing its state like the results of Promise.allSettled:
+/// {status: "pending"}, {status: "fulfilled", value} or
+/// {status: "rejected", reason}.
+CallResult<HermesValue> hermesInternalGetPromiseState(
+    void *,
+    Runtime &runtime) {
+  NativeArgs args = runtime.getCurrentFrame().getNativeArgs();
+  auto promise = args.dyncastArg<JSPromise>(0);
+  if (!promise)
+    return HermesValue::encodeUndefinedValue();
+
+  struct : public Locals {
+    PinnedValue<JSObject> resultHandle;
+    PinnedValue<> tmpHandle;
+  } lv;
+  LocalsRAII lraii(runtime, &lv);
+  lv.resultHandle = JSObject::create(runtime);
+
+  Predefined::Str status = Predefined::pending;
+  Predefined::Str resultName = Predefined::value;
+  switch (promise->getState()) {
+    case JSPromise::State::Pending:
+      break;
+    case JSPromise::State::Fulfilled:
+      status = Predefined::fulfilled;
+      break;
+    case JSPromise::State::Rejected:
+      status = Predefined::rejected;
+      resultName = Predefined::reason;
+      break;
+  }
+  auto res = JSObject::defineOwnProperty(
+      lv.resultHandle,
+      runtime,
+      Predefined::getSymbolID(Predefined::status),
+      DefinePropertyFlags::getDefaultNewPropertyFlags(),
+      runtime.getPredefinedStringHandle(status));
+  assert(res != ExecutionStatus::EXCEPTION && "Failed to set status");
+  (void)res;
+
+  if (promise->getState() != JSPromise::State::Pending) {
+    lv.tmpHandle = promise->getResult();
+    res = JSObject::defineOwnProperty(
+        lv.resultHandle,
+        runtime,
+        Predefined::getSymbolID(resultName),
+        DefinePropertyFlags::getDefaultNewPropertyFlags(),
+        lv.tmpHandle);
+    assert(res != ExecutionStatus::EXCEPTION && "Failed to set result");
+    (void)res;
+  }
+  return lv.resultHandle.getHermesValue();
+}
+
 /// \code
-///   HermesInternal.setPromiseRejectionTrackingHook = function (func) {}
+///   HermesInternal.setPromiseRejectionTrackingHook =
+///     function (func, tracker) {}
 /// \endcode
 /// Register the function which can be used to *enable* Promise rejection
 /// tracking when the user calls it.
@@ -655,11 +720,15 @@ CallResult<HermesValue> hermesInternalGetFunctionLocation(
 ///     require('./rejection-tracking.js').enable
 ///   );
 /// \endcode
+/// The optional \p tracker is called by the native Promise implementation as
+/// tracker(promise, reason, isHandled) whenever a promise is rejected without
+/// a handler, or gets its first handler after such a rejection.
 CallResult<HermesValue> hermesInternalSetPromiseRejectionTrackingHook(
     void *,
     Runtime &runtime) {
   NativeArgs args = runtime.getCurrentFrame().getNativeArgs();
   runtime.promiseRejectionTrackingHook_ = args.getArg(0);
+  runtime.promiseRejectionTracker_ = args.getArg(1);
   return HermesValue::encodeUndefinedValue();
 }
 
@@ -888,6 +957,7 @@ HermesValue createHermesInternalObject(
   defineInternMethod(P::ttiReached, hermesInternalTTIReached);
   defineInternMethod(P::ttrcReached, hermesInternalTTRCReached);
   defineInternMethod(P::getFunctionLocation, hermesInternalGetFunctionLocation);
+  defineInternMethod(P::getPromiseState, hermesInternalGetPromiseState);
 
   if (LLVM_UNLIKELY(runtime.traceMode != SynthTraceMode::None)) {
     // Use getNewNonEnumerableFlags() so that getInstrumentedStats can be
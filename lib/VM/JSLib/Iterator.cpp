@@ -0,0 +1,868 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+//===----------------------------------------------------------------------===//
+/// \file
+/// ES2025 27.1.3 Iterator Objects: the Iterator constructor, the helper
+/// methods of Iterator.prototype, %IteratorHelperPrototype% and
+/// %WrapForValidIteratorPrototype%.
+//===----------------------------------------------------------------------===//
+#include "JSLibInternal.h"
+
+#include "hermes/VM/JSIteratorHelper.h"
+#include "hermes/VM/JSNativeFunctions.h"
+#include "hermes/VM/Operations.h"
+#include "hermes/VM/Runtime.h"
+
+namespace hermes {
+namespace vm {
+
+HermesValue createIteratorConstructor(Runtime &runtime) {
+  auto iteratorPrototype =
+      Handle<JSObject>::vmcast(&runtime.iteratorPrototype);
+
+  struct : public Locals {
+    PinnedValue<NativeConstructor> cons;
+  } lv;
+  LocalsRAII lraii(runtime, &lv);
+
+  defineSystemConstructor(
+      runtime,
+      Predefined::getSymbolID(Predefined::Iterator),
+      iteratorConstructor,
+      iteratorPrototype,
+      0,
+      lv.cons);
+
+  // Iterator.from.
+  defineMethod(
+      runtime,
+      lv.cons,
+      Predefined::getSymbolID(Predefined::from),
+      nullptr,
+      iteratorFrom,
+      1);
+
+  // Iterator.prototype.constructor and Iterator.prototype[@@toStringTag] are
+  // accessors, so that assigning them on objects inheriting from
+  // Iterator.prototype defines own properties.
+  defineAccessor(
+      runtime,
+      iteratorPrototype,
+      Predefined::getSymbolID(Predefined::constructor),
+      nullptr,
+      iteratorPrototypeConstructorGetter,
+      iteratorPrototypeConstructorSetter,
+      false,
+      true);
+  defineAccessor(
+      runtime,
+      iteratorPrototype,
+      Predefined::getSymbolID(Predefined::SymbolToStringTag),
+      Predefined::getSymbolID(Predefined::squareSymbolToStringTag),
+      nullptr,
+      iteratorPrototypeToStringTagGetter,
+      iteratorPrototypeToStringTagSetter,
+      false,
+      true);
+
+  // Iterator.prototype methods.
+  defineMethod(
+      runtime,
+      iteratorPrototype,
+      Predefined::getSymbolID(Predefined::map),
+      nullptr,
+      iteratorPrototypeMap,
+      1);
+  defineMethod(
+      runtime,
+      iteratorPrototype,
+      Predefined::getSymbolID(Predefined::filter),
+      nullptr,
+      iteratorPrototypeFilter,
+      1);
+  defineMethod(
+      runtime,
+      iteratorPrototype,
+      Predefined::getSymbolID(Predefined::take),
+      nullptr,
+      iteratorPrototypeTake,
+      1);
+  defineMethod(
+      runtime,
+      iteratorPrototype,
+      Predefined::getSymbolID(Predefined::drop),
+      nullptr,
+      iteratorPrototypeDrop,
+      1);
+  defineMethod(
+      runtime,
+      iteratorPrototype,
+      Predefined::getSymbolID(Predefined::flatMap),
+      nullptr,
+      iteratorPrototypeFlatMap,
+      1);
+  defineMethod(
+      runtime,
+      iteratorPrototype,
+      Predefined::getSymbolID(Predefined::reduce),
+      nullptr,
+      iteratorPrototypeReduce,
+      1);
+  defineMethod(
+      runtime,
+      iteratorPrototype,
+      Predefined::getSymbolID(Predefined::toArray),
+      nullptr,
+      iteratorPrototypeToArray,
+      0);
+  defineMethod(
+      runtime,
+      iteratorPrototype,
+      Predefined::getSymbolID(Predefined::forEach),
+      nullptr,
+      iteratorPrototypeForEach,
+      1);
+  defineMethod(
+      runtime,
+      iteratorPrototype,
+      Predefined::getSymbolID(Predefined::some),
+      nullptr,
+      iteratorPrototypeSome,
+      1);
+  defineMethod(
+      runtime,
+      iteratorPrototype,
+      Predefined::getSymbolID(Predefined::every),
+      nullptr,
+      iteratorPrototypeEvery,
+      1);
+  defineMethod(
+      runtime,
+      iteratorPrototype,
+      Predefined::getSymbolID(Predefined::find),
+      nullptr,
+      iteratorPrototypeFind,
+      1);
+
+  // %IteratorHelperPrototype%.
+  auto iteratorHelperPrototype =
+      Handle<JSObject>::vmcast(&runtime.iteratorHelperPrototype);
+  defineMethod(
+      runtime,
+      iteratorHelperPrototype,
+      Predefined::getSymbolID(Predefined::next),
+      nullptr,
+      iteratorHelperPrototypeNext,
+      0);
+  defineMethod(
+      runtime,
+      iteratorHelperPrototype,
+      Predefined::getSymbolID(Predefined::returnStr),
+      nullptr,
+      iteratorHelperPrototypeReturn,
+      0);
+
+  DefinePropertyFlags dpf = DefinePropertyFlags::getDefaultNewPropertyFlags();
+  dpf.writable = 0;
+  dpf.enumerable = 0;
+  dpf.configurable = 1;
+
+  // ES2025 27.1.2.1.3 %IteratorHelperPrototype% [ @@toStringTag ]
+  defineProperty(
+      runtime,
+      iteratorHelperPrototype,
+      Predefined::getSymbolID(Predefined::SymbolToStringTag),
+      runtime.getPredefinedStringHandle(Predefined::IteratorHelper),
+      dpf);
+
+  // %WrapForValidIteratorPrototype%.
+  auto wrapForValidIteratorPrototype =
+      Handle<JSObject>::vmcast(&runtime.wrapForValidIteratorPrototype);
+  defineMethod(
+      runtime,
+      wrapForValidIteratorPrototype,
+      Predefined::getSymbolID(Predefined::next),
+      nullptr,
+      wrapForValidIteratorPrototypeNext,
+      0);
+  defineMethod(
+      runtime,
+      wrapForValidIteratorPrototype,
+      Predefined::getSymbolID(Predefined::returnStr),
+      nullptr,
+      wrapForValidIteratorPrototypeReturn,
+      0);
+
+  return lv.cons.getHermesValue();
+}
+
+// ES2025 27.1.3.1.1 Iterator ( )
+CallResult<HermesValue> iteratorConstructor(void *, Runtime &runtime) {
+  NativeArgs args = runtime.getCurrentFrame().getNativeArgs();
+  // 1. If NewTarget is either undefined or the active function object, throw
+  // a TypeError exception.
+  if (!args.isConstructorCall() ||
+      args.getNewTarget().getRaw() ==
+          runtime.iteratorConstructor.getHermesValue().getRaw()) {
+    return runtime.raiseTypeError(
+        "Iterator cannot be called or constructed directly");
+  }
+
+  // 2. Return ? OrdinaryCreateFromConstructor(NewTarget,
+  // "%Iterator.prototype%").
+  CallResult<PseudoHandle<JSObject>> thisParentRes =
+      NativeConstructor::parentForNewThis_RJS(
+          runtime,
+          Handle<Callable>::vmcast(&args.getNewTarget()),
+          runtime.iteratorPrototype);
+  if (LLVM_UNLIKELY(thisParentRes == ExecutionStatus::EXCEPTION)) {
+    return ExecutionStatus::EXCEPTION;
+  }
+  struct : public Locals {
+    PinnedValue<JSObject> selfParent;
+  } lv;
+  LocalsRAII lraii(runtime, &lv);
+  lv.selfParent = std::move(*thisParentRes);
+  return JSObject::create(runtime, lv.selfParent).getHermesValue();
+}
+
+// ES2025 27.1.3.2.1 Iterator.from ( O )
+CallResult<HermesValue> iteratorFrom(void *, Runtime &runtime) {
+  NativeArgs args = runtime.getCurrentFrame().getNativeArgs();
+  // 1. Let iteratorRecord be ? GetIteratorFlattenable(O,
+  // iterate-string-primitives).
+  auto recordRes = getIteratorFlattenable(
+      runtime,
+      args.getArgHandle(0),
+      PrimitiveHandling::IterateStringPrimitives);
+  if (LLVM_UNLIKELY(recordRes == ExecutionStatus::EXCEPTION)) {
+    return ExecutionStatus::EXCEPTION;
+  }
+  // 2. Let hasInstance be ? OrdinaryHasInstance(%Iterator%,
+  // iteratorRecord.[[Iterator]]).
+  auto hasInstanceRes = ordinaryHasInstance(
+      runtime,
+      Handle<>::vmcast(&runtime.iteratorConstructor),
+      recordRes->iterator);
+  if (LLVM_UNLIKELY(hasInstanceRes == ExecutionStatus::EXCEPTION)) {
+    return ExecutionStatus::EXCEPTION;
+  }
+  // 3. If hasInstance is true, then
+  //   a. Return iteratorRecord.[[Iterator]].
+  if (*hasInstanceRes) {
+    return recordRes->iterator.getHermesValue();
+  }
+  // 4. Let wrapper be OrdinaryObjectCreate(%WrapForValidIteratorPrototype%,
+  // « [[Iterated]] »).
+  // 5. Set wrapper.[[Iterated]] to iteratorRecord.
+  // 6. Return wrapper.
+  return JSWrapForValidIterator::create(
+             runtime, recordRes->iterator, recordRes->nextMethod)
+      .getHermesValue();
+}
+
+/// ES2025 7.3.36 SetterThatIgnoresPrototypeProperties ( thisValue, home, p,
+/// v ), where home is %Iterator.prototype% and v the first argument.
+static CallResult<HermesValue> setterThatIgnoresPrototypeProperties(
+    Runtime &runtime,
+    NativeArgs args,
+    SymbolID p) {
+  // 1. If thisValue is not an Object, then
+  //   a. Throw a TypeError exception.
+  auto O = args.dyncastThis<JSObject>();
+  if (LLVM_UNLIKELY(!O)) {
+    return runtime.raiseTypeError(
+        "Iterator.prototype setter called on non-object");
+  }
+  // 2. If SameValue(thisValue, home) is true, then
+  //   b. Throw a TypeError exception.
+  if (O.getHermesValue().getRaw() ==
+      runtime.iteratorPrototype.getHermesValue().getRaw()) {
+    return runtime.raiseTypeError(
+        "Cannot assign to read only property of Iterator.prototype");
+  }
+
+  struct : public Locals {
+    PinnedValue<> key;
+  } lv;
+  LocalsRAII lraii(runtime, &lv);
+  lv.key = HermesValue::encodeSymbolValue(p);
+
+  // 3. Let desc be ? thisValue.[[GetOwnProperty]](p).
+  ComputedPropertyDescriptor desc;
+  auto hasOwnRes = JSObject::getOwnComputedDescriptor(O, runtime, lv.key, desc);
+  if (LLVM_UNLIKELY(hasOwnRes == ExecutionStatus::EXCEPTION)) {
+    return ExecutionStatus::EXCEPTION;
+  }
+  if (!*hasOwnRes) {
+    // 4. If desc is undefined, then
+    //   a. Perform ? CreateDataPropertyOrThrow(thisValue, p, v).
+    if (LLVM_UNLIKELY(
+            JSObject::defineOwnComputed(
+                O,
+                runtime,
+                lv.key,
+                DefinePropertyFlags::getDefaultNewPropertyFlags(),
+                args.getArgHandle(0),
+                PropOpFlags().plusThrowOnError()) ==
+            ExecutionStatus::EXCEPTION)) {
+      return ExecutionStatus::EXCEPTION;
+    }
+  } else {
+    // 5. Else,
+    //   a. Perform ? Set(thisValue, p, v, true).
+    if (LLVM_UNLIKELY(
+            JSObject::putComputed_RJS(
+                O,
+                runtime,
+                lv.key,
+                args.getArgHandle(0),
+                PropOpFlags().plusThrowOnError()) ==
+            ExecutionStatus::EXCEPTION)) {
+      return ExecutionStatus::EXCEPTION;
+    }
+  }
+  // 6. Return unused.
+  return HermesValue::encodeUndefinedValue();
+}
+
+// ES2025 27.1.4.1.1 get Iterator.prototype.constructor
+CallResult<HermesValue> iteratorPrototypeConstructorGetter(
+    void *,
+    Runtime &runtime) {
+  // 1. Return %Iterator%.
+  return runtime.iteratorConstructor.getHermesValue();
+}
+
+// ES2025 27.1.4.1.2 set Iterator.prototype.constructor
+CallResult<HermesValue> iteratorPrototypeConstructorSetter(
+    void *,
+    Runtime &runtime) {
+  // 1. Perform ? SetterThatIgnoresPrototypeProperties(this value,
+  // %Iterator.prototype%, "constructor", v).
+  return setterThatIgnoresPrototypeProperties(
+      runtime,
+      runtime.getCurrentFrame().getNativeArgs(),
+      Predefined::getSymbolID(Predefined::constructor));
+}
+
+// ES2025 27.1.4.14.1 get Iterator.prototype [ @@toStringTag ]
+CallResult<HermesValue> iteratorPrototypeToStringTagGetter(
+    void *,
+    Runtime &runtime) {
+  // 1. Return "Iterator".
+  return HermesValue::encodeStringValue(
+      runtime.getPredefinedString(Predefined::Iterator));
+}
+
+// ES2025 27.1.4.14.2 set Iterator.prototype [ @@toStringTag ]
+CallResult<HermesValue> iteratorPrototypeToStringTagSetter(
+    void *,
+    Runtime &runtime) {
+  // 1. Perform ? SetterThatIgnoresPrototypeProperties(this value,
+  // %Iterator.prototype%, %Symbol.toStringTag%, v).
+  return setterThatIgnoresPrototypeProperties(
+      runtime,
+      runtime.getCurrentFrame().getNativeArgs(),
+      Predefined::getSymbolID(Predefined::SymbolToStringTag));
+}
+
+/// Steps 1-4 of the Iterator.prototype methods taking a function:
+///   1. Let O be the this value.
+///   2. If O is not an Object, throw a TypeError exception.
+///   3. Let iterated be the Iterator Record { [[Iterator]]: O, [[NextMethod]]:
+///      undefined, [[Done]]: false }.
+///   4. If IsCallable(fn) is false, then
+///     a. Let error be ThrowCompletion(a newly created TypeError object).
+///     b. Return ? IteratorClose(iterated, error).
+/// \param name the name of the method, for error messages.
+/// \return O, or EXCEPTION.
+static CallResult<Handle<JSObject>> thisIteratorWithFunction(
+    Runtime &runtime,
+    NativeArgs args,
+    const char *name) {
+  auto O = args.dyncastThis<JSObject>();
+  if (LLVM_UNLIKELY(!O)) {
+    return runtime.raiseTypeError(
+        TwineChar16("Iterator.prototype.") + name +
+        " called on non-object");
+  }
+  if (LLVM_UNLIKELY(!vmisa<Callable>(args.getArg(0)))) {
+    (void)runtime.raiseTypeError(
+        TwineChar16("Iterator.prototype.") + name +
+        " argument is not a function");
+    return iteratorCloseAndRethrow(runtime, O);
+  }
+  return O;
+}
+
+/// Implement Iterator.prototype.map, filter and flatMap, which return a
+/// helper of \p kind calling the function passed as argument.
+static CallResult<HermesValue> iteratorPrototypeHelperWithFunction(
+    Runtime &runtime,
+    JSIteratorHelper::Kind kind,
+    const char *name) {
+  NativeArgs args = runtime.getCurrentFrame().getNativeArgs();
+  auto ORes = thisIteratorWithFunction(runtime, args, name);
+  if (LLVM_UNLIKELY(ORes == ExecutionStatus::EXCEPTION)) {
+    return ExecutionStatus::EXCEPTION;
+  }
+  // 5. Set iterated to ? GetIteratorDirect(O).
+  auto recordRes = getIteratorDirect(runtime, *ORes);
+  if (LLVM_UNLIKELY(recordRes == ExecutionStatus::EXCEPTION)) {
+    return ExecutionStatus::EXCEPTION;
+  }
+  // 6. Let closure be a new Abstract Closure ...
+  // 7. Let result be CreateIteratorFromClosure(closure, "Iterator Helper",
+  // %IteratorHelperPrototype%, « [[UnderlyingIterators]] »).
+  // 8. Set result.[[UnderlyingIterators]] to « iterated ».
+  return JSIteratorHelper::create(
+             runtime,
+             kind,
+             recordRes->iterator,
+             recordRes->nextMethod,
+             Handle<Callable>::vmcast(args.getArgHandle(0)),
+             0)
+      .getHermesValue();
+}
+
+/// Implement Iterator.prototype.take and drop, which return a helper of
+/// \p kind taking or dropping the number of values passed as argument.
+static CallResult<HermesValue> iteratorPrototypeHelperWithLimit(
+    Runtime &runtime,
+    JSIteratorHelper::Kind kind,
+    const char *name) {
+  NativeArgs args = runtime.getCurrentFrame().getNativeArgs();
+  // 1. Let O be the this value.
+  // 2. If O is not an Object, throw a TypeError exception.
+  auto O = args.dyncastThis<JSObject>();
+  if (LLVM_UNLIKELY(!O)) {
+    return runtime.raiseTypeError(
+        TwineChar16("Iterator.prototype.") + name +
+        " called on non-object");
+  }
+  // 3. Let iterated be the Iterator Record { [[Iterator]]: O,
+  // [[NextMethod]]: undefined, [[Done]]: false }.
+  // 4. Let numLimit be Completion(ToNumber(limit)).
+  // 5. IfAbruptCloseIterator(numLimit, iterated).
+  auto numLimitRes = toNumber_RJS(runtime, args.getArgHandle(0));
+  if (LLVM_UNLIKELY(numLimitRes == ExecutionStatus::EXCEPTION)) {
+    return iteratorCloseAndRethrow(runtime, O);
+  }
+  double numLimit = numLimitRes->getNumber();
+  // 6. If numLimit is NaN, then
+  //   a. Let error be ThrowCompletion(a newly created RangeError object).
+  //   b. Return ? IteratorClose(iterated, error).
+  // 7. Let integerLimit be ! ToIntegerOrInfinity(numLimit).
+  // 8. If integerLimit < 0, then
+  //   a. Let error be ThrowCompletion(a newly created RangeError object).
+  //   b. Return ? IteratorClose(iterated, error).
+  double integerLimit = std::trunc(numLimit);
+  if (LLVM_UNLIKELY(std::isnan(numLimit) || integerLimit < 0)) {
+    (void)runtime.raiseRangeError(
+        TwineChar16("Iterator.prototype.") + name +
+        " argument must be a non-negative number");
+    return iteratorCloseAndRethrow(runtime, O);
+  }
+  // 9. Set iterated to ? GetIteratorDirect(O).
+  auto recordRes = getIteratorDirect(runtime, O);
+  if (LLVM_UNLIKELY(recordRes == ExecutionStatus::EXCEPTION)) {
+    return ExecutionStatus::EXCEPTION;
+  }
+  // 10. Let closure be a new Abstract Closure ...
+  // 11. Let result be CreateIteratorFromClosure(closure, "Iterator Helper",
+  // %IteratorHelperPrototype%, « [[UnderlyingIterators]] »).
+  // 12. Set result.[[UnderlyingIterators]] to « iterated ».
+  return JSIteratorHelper::create(
+             runtime,
+             kind,
+             recordRes->iterator,
+             recordRes->nextMethod,
+             Runtime::makeNullHandle<Callable>(),
+             integerLimit + 0.0)
+      .getHermesValue();
+}
+
+// ES2025 27.1.4.8 Iterator.prototype.map ( mapper )
+CallResult<HermesValue> iteratorPrototypeMap(void *, Runtime &runtime) {
+  return iteratorPrototypeHelperWithFunction(
+      runtime, JSIteratorHelper::Kind::Map, "map");
+}
+
+// ES2025 27.1.4.4 Iterator.prototype.filter ( predicate )
+CallResult<HermesValue> iteratorPrototypeFilter(void *, Runtime &runtime) {
+  return iteratorPrototypeHelperWithFunction(
+      runtime, JSIteratorHelper::Kind::Filter, "filter");
+}
+
+// ES2025 27.1.4.6 Iterator.prototype.flatMap ( mapper )
+CallResult<HermesValue> iteratorPrototypeFlatMap(void *, Runtime &runtime) {
+  return iteratorPrototypeHelperWithFunction(
+      runtime, JSIteratorHelper::Kind::FlatMap, "flatMap");
+}
+
+// ES2025 27.1.4.11 Iterator.prototype.take ( limit )
+CallResult<HermesValue> iteratorPrototypeTake(void *, Runtime &runtime) {
+  return iteratorPrototypeHelperWithLimit(
+      runtime, JSIteratorHelper::Kind::Take, "take");
+}
+
+// ES2025 27.1.4.2 Iterator.prototype.drop ( limit )
+CallResult<HermesValue> iteratorPrototypeDrop(void *, Runtime &runtime) {
+  return iteratorPrototypeHelperWithLimit(
+      runtime, JSIteratorHelper::Kind::Drop, "drop");
+}
+
+// ES2025 27.1.4.9 Iterator.prototype.reduce ( reducer [ , initialValue ] )
+CallResult<HermesValue> iteratorPrototypeReduce(void *, Runtime &runtime) {
+  NativeArgs args = runtime.getCurrentFrame().getNativeArgs();
+  auto ORes = thisIteratorWithFunction(runtime, args, "reduce");
+  if (LLVM_UNLIKELY(ORes == ExecutionStatus::EXCEPTION)) {
+    return ExecutionStatus::EXCEPTION;
+  }
+  // 5. Set iterated to ? GetIteratorDirect(O).
+  auto recordRes = getIteratorDirect(runtime, *ORes);
+  if (LLVM_UNLIKELY(recordRes == ExecutionStatus::EXCEPTION)) {
+    return ExecutionStatus::EXCEPTION;
+  }
+  Handle<JSObject> iterated = recordRes->iterator;
+  Handle<> nextMethod = recordRes->nextMethod;
+  auto reducer = Handle<Callable>::vmcast(args.getArgHandle(0));
+
+  struct : public Locals {
+    PinnedValue<> accumulator;
+    PinnedValue<> value;
+  } lv;
+  LocalsRAII lraii(runtime, &lv);
+
+  double counter;
+  if (args.getArgCount() < 2) {
+    // 6. If initialValue is not present, then
+    //   a. Let accumulator be ? IteratorStepValue(iterated).
+    auto stepRes = iteratorStepValueDirect(
+        runtime, iterated, nextMethod, &lv.accumulator);
+    if (LLVM_UNLIKELY(stepRes == ExecutionStatus::EXCEPTION)) {
+      return ExecutionStatus::EXCEPTION;
+    }
+    //   b. If accumulator is done, throw a TypeError exception.
+    if (!*stepRes) {
+      return runtime.raiseTypeError(
+          "Reduce of empty iterator with no initial value");
+    }
+    //   c. Let counter be 1.
+    counter = 1;
+  } else {
+    // 7. Else,
+    //   a. Let accumulator be initialValue.
+    //   b. Let counter be 0.
+    lv.accumulator = args.getArg(1);
+    counter = 0;
+  }
+
+  // 8. Repeat,
+  for (GCScopeMarkerRAII marker{runtime};; marker.flush()) {
+    // a. Let value be ? IteratorStepValue(iterated).
+    auto stepRes =
+        iteratorStepValueDirect(runtime, iterated, nextMethod, &lv.value);
+    if (LLVM_UNLIKELY(stepRes == ExecutionStatus::EXCEPTION)) {
+      return ExecutionStatus::EXCEPTION;
+    }
+    // b. If value is done, return accumulator.
+    if (!*stepRes) {
+      return lv.accumulator.getHermesValue();
+    }
+    // c. Let result be Completion(Call(reducer, undefined, « accumulator,
+    // value, 𝔽(counter) »)).
+    auto resultRes = Callable::executeCall3(
+        reducer,
+        runtime,
+        Runtime::getUndefinedValue(),
+        lv.accumulator.getHermesValue(),
+        lv.value.getHermesValue(),
+        HermesValue::encodeTrustedNumberValue(counter));
+    // d. IfAbruptCloseIterator(result, iterated).
+    if (LLVM_UNLIKELY(resultRes == ExecutionStatus::EXCEPTION)) {
+      return iteratorCloseAndRethrow(runtime, iterated);
+    }
+    // e. Set accumulator to result.
+    lv.accumulator = std::move(*resultRes);
+    // f. Set counter to counter + 1.
+    counter += 1;
+  }
+}
+
+// ES2025 27.1.4.12 Iterator.prototype.toArray ( )
+CallResult<HermesValue> iteratorPrototypeToArray(void *, Runtime &runtime) {
+  NativeArgs args = runtime.getCurrentFrame().getNativeArgs();
+  // 1. Let O be the this value.
+  // 2. If O is not an Object, throw a TypeError exception.
+  auto O = args.dyncastThis<JSObject>();
+  if (LLVM_UNLIKELY(!O)) {
+    return runtime.raiseTypeError(
+        "Iterator.prototype.toArray called on non-object");
+  }
+  // 3. Let iterated be ? GetIteratorDirect(O).
+  auto recordRes = getIteratorDirect(runtime, O);
+  if (LLVM_UNLIKELY(recordRes == ExecutionStatus::EXCEPTION)) {
+    return ExecutionStatus::EXCEPTION;
+  }
+  Handle<JSObject> iterated = recordRes->iterator;
+  Handle<> nextMethod = recordRes->nextMethod;
+
+  struct : public Locals {
+    PinnedValue<JSArray> items;
+    PinnedValue<> value;
+  } lv;
+  LocalsRAII lraii(runtime, &lv);
+
+  // 4. Let items be a new empty List.
+  auto arrRes = JSArray::create(runtime, 0, 0);
+  if (LLVM_UNLIKELY(arrRes == ExecutionStatus::EXCEPTION)) {
+    return ExecutionStatus::EXCEPTION;
+  }
+  lv.items = std::move(*arrRes);
+  uint32_t n = 0;
+
+  // 5. Repeat,
+  for (GCScopeMarkerRAII marker{runtime};; marker.flush()) {
+    // a. Let value be ? IteratorStepValue(iterated).
+    auto stepRes =
+        iteratorStepValueDirect(runtime, iterated, nextMethod, &lv.value);
+    if (LLVM_UNLIKELY(stepRes == ExecutionStatus::EXCEPTION)) {
+      return ExecutionStatus::EXCEPTION;
+    }
+    // b. If value is done, return CreateArrayFromList(items).
+    if (!*stepRes) {
+      break;
+    }
+    // c. Append value to items.
+    if (LLVM_UNLIKELY(
+            JSArray::setElementAt(lv.items, runtime, n, lv.value) ==
+            ExecutionStatus::EXCEPTION)) {
+      return ExecutionStatus::EXCEPTION;
+    }
+    ++n;
+  }
+  if (LLVM_UNLIKELY(
+          JSArray::setLengthProperty(lv.items, runtime, n) ==
+          ExecutionStatus::EXCEPTION)) {
+    return ExecutionStatus::EXCEPTION;
+  }
+  return lv.items.getHermesValue();
+}
+
+namespace {
+
+/// The Iterator.prototype methods which call a predicate on every value
+/// until it returns a given result.
+enum class PredicateKind { ForEach, Some, Every, Find };
+
+} // namespace
+
+/// Implement Iterator.prototype.forEach, some, every and find.
+static CallResult<HermesValue> iteratorPrototypeWithPredicate(
+    Runtime &runtime,
+    PredicateKind kind,
+    const char *name) {
+  NativeArgs args = runtime.getCurrentFrame().getNativeArgs();
+  auto ORes = thisIteratorWithFunction(runtime, args, name);
+  if (LLVM_UNLIKELY(ORes == ExecutionStatus::EXCEPTION)) {
+    return ExecutionStatus::EXCEPTION;
+  }
+  // 5. Set iterated to ? GetIteratorDirect(O).
+  auto recordRes = getIteratorDirect(runtime, *ORes);
+  if (LLVM_UNLIKELY(recordRes == ExecutionStatus::EXCEPTION)) {
+    return ExecutionStatus::EXCEPTION;
+  }
+  Handle<JSObject> iterated = recordRes->iterator;
+  Handle<> nextMethod = recordRes->nextMethod;
+  auto fn = Handle<Callable>::vmcast(args.getArgHandle(0));
+
+  struct : public Locals {
+    PinnedValue<> value;
+  } lv;
+  LocalsRAII lraii(runtime, &lv);
+
+  // 6. Let counter be 0.
+  double counter = 0;
+  // 7. Repeat,
+  for (GCScopeMarkerRAII marker{runtime};; marker.flush()) {
+    // a. Let value be ? IteratorStepValue(iterated).
+    auto stepRes =
+        iteratorStepValueDirect(runtime, iterated, nextMethod, &lv.value);
+    if (LLVM_UNLIKELY(stepRes == ExecutionStatus::EXCEPTION)) {
+      return ExecutionStatus::EXCEPTION;
+    }
+    // b. If value is done, return undefined (forEach, find), false (some) or
+    // true (every).
+    if (!*stepRes) {
+      switch (kind) {
+        case PredicateKind::Some:
+          return HermesValue::encodeBoolValue(false);
+        case PredicateKind::Every:
+          return HermesValue::encodeBoolValue(true);
+        default:
+          return HermesValue::encodeUndefinedValue();
+      }
+    }
+    // c. Let result be Completion(Call(fn, undefined, « value, 𝔽(counter)
+    // »)).
+    auto resultRes = Callable::executeCall2(
+        fn,
+        runtime,
+        Runtime::getUndefinedValue(),
+        lv.value.getHermesValue(),
+        HermesValue::encodeTrustedNumberValue(counter));
+    // d. IfAbruptCloseIterator(result, iterated).
+    if (LLVM_UNLIKELY(resultRes == ExecutionStatus::EXCEPTION)) {
+      return iteratorCloseAndRethrow(runtime, iterated);
+    }
+    if (kind != PredicateKind::ForEach) {
+      // e. If ToBoolean(result) is true (false for every), return
+      // ? IteratorClose(iterated, NormalCompletion(true, false or value)).
+      bool selected = toBoolean(resultRes->get());
+      if (selected != (kind == PredicateKind::Every)) {
+        if (kind != PredicateKind::Find)
+          lv.value = HermesValue::encodeBoolValue(selected);
+        if (LLVM_UNLIKELY(
+                iteratorClose(runtime, iterated, Runtime::getEmptyValue()) ==
+                ExecutionStatus::EXCEPTION)) {
+          return ExecutionStatus::EXCEPTION;
+        }
+        return lv.value.getHermesValue();
+      }
+    }
+    // f. Set counter to counter + 1.
+    counter += 1;
+  }
+}
+
+// ES2025 27.1.4.7 Iterator.prototype.forEach ( procedure )
+CallResult<HermesValue> iteratorPrototypeForEach(void *, Runtime &runtime) {
+  return iteratorPrototypeWithPredicate(
+      runtime, PredicateKind::ForEach, "forEach");
+}
+
+// ES2025 27.1.4.10 Iterator.prototype.some ( predicate )
+CallResult<HermesValue> iteratorPrototypeSome(void *, Runtime &runtime) {
+  return iteratorPrototypeWithPredicate(runtime, PredicateKind::Some, "some");
+}
+
+// ES2025 27.1.4.3 Iterator.prototype.every ( predicate )
+CallResult<HermesValue> iteratorPrototypeEvery(void *, Runtime &runtime) {
+  return iteratorPrototypeWithPredicate(
+      runtime, PredicateKind::Every, "every");
+}
+
+// ES2025 27.1.4.5 Iterator.prototype.find ( predicate )
+CallResult<HermesValue> iteratorPrototypeFind(void *, Runtime &runtime) {
+  return iteratorPrototypeWithPredicate(runtime, PredicateKind::Find, "find");
+}
+
+// ES2025 27.1.2.1.1 %IteratorHelperPrototype%.next ( )
+CallResult<HermesValue> iteratorHelperPrototypeNext(void *, Runtime &runtime) {
+  NativeArgs args = runtime.getCurrentFrame().getNativeArgs();
+  // 1. Return ? GeneratorResume(this value, undefined, "Iterator Helper").
+  auto self = args.dyncastThis<JSIteratorHelper>();
+  if (LLVM_UNLIKELY(!self)) {
+    return runtime.raiseTypeError(
+        "Iterator Helper next() called on incompatible receiver");
+  }
+  return JSIteratorHelper::next(self, runtime);
+}
+
+// ES2025 27.1.2.1.2 %IteratorHelperPrototype%.return ( )
+CallResult<HermesValue> iteratorHelperPrototypeReturn(
+    void *,
+    Runtime &runtime) {
+  NativeArgs args = runtime.getCurrentFrame().getNativeArgs();
+  // 1. Let O be this value.
+  // 2. Perform ? RequireInternalSlot(O, [[UnderlyingIterators]]).
+  auto self = args.dyncastThis<JSIteratorHelper>();
+  if (LLVM_UNLIKELY(!self)) {
+    return runtime.raiseTypeError(
+        "Iterator Helper return() called on incompatible receiver");
+  }
+  return JSIteratorHelper::returnImpl(self, runtime);
+}
+
+// ES2025 27.1.3.2.1.1.1 %WrapForValidIteratorPrototype%.next ( )
+CallResult<HermesValue> wrapForValidIteratorPrototypeNext(
+    void *,
+    Runtime &runtime) {
+  NativeArgs args = runtime.getCurrentFrame().getNativeArgs();
+  // 1. Let O be this value.
+  // 2. Perform ? RequireInternalSlot(O, [[Iterated]]).
+  auto self = args.dyncastThis<JSWrapForValidIterator>();
+  if (LLVM_UNLIKELY(!self)) {
+    return runtime.raiseTypeError(
+        "WrapForValidIterator next() called on incompatible receiver");
+  }
+
+  struct : public Locals {
+    PinnedValue<JSObject> iterator;
+    PinnedValue<> nextMethod;
+  } lv;
+  LocalsRAII lraii(runtime, &lv);
+  // 3. Let iteratorRecord be O.[[Iterated]].
+  lv.iterator = self->getIterated(runtime);
+  lv.nextMethod = self->getNextMethod();
+  // 4. Return ? Call(iteratorRecord.[[NextMethod]],
+  // iteratorRecord.[[Iterator]]).
+  if (LLVM_UNLIKELY(!vmisa<Callable>(*lv.nextMethod))) {
+    return runtime.raiseTypeError(
+        "'next' method on iterator must be callable");
+  }
+  return Callable::executeCall0(
+             Handle<Callable>::vmcast(&lv.nextMethod), runtime, lv.iterator)
+      .toCallResultHermesValue();
+}
+
+// ES2025 27.1.3.2.1.1.2 %WrapForValidIteratorPrototype%.return ( )
+CallResult<HermesValue> wrapForValidIteratorPrototypeReturn(
+    void *,
+    Runtime &runtime) {
+  NativeArgs args = runtime.getCurrentFrame().getNativeArgs();
+  // 1. Let O be this value.
+  // 2. Perform ? RequireInternalSlot(O, [[Iterated]]).
+  auto self = args.dyncastThis<JSWrapForValidIterator>();
+  if (LLVM_UNLIKELY(!self)) {
+    return runtime.raiseTypeError(
+        "WrapForValidIterator return() called on incompatible receiver");
+  }
+
+  struct : public Locals {
+    PinnedValue<JSObject> iterator;
+  } lv;
+  LocalsRAII lraii(runtime, &lv);
+  // 3. Let iterator be O.[[Iterated]].[[Iterator]].
+  lv.iterator = self->getIterated(runtime);
+  // 5. Let returnMethod be ? GetMethod(iterator, "return").
+  auto returnMethodRes = getMethod(
+      runtime,
+      lv.iterator,
+      runtime.makeHandle(Predefined::getSymbolID(Predefined::returnStr)));
+  if (LLVM_UNLIKELY(returnMethodRes == ExecutionStatus::EXCEPTION)) {
+    return ExecutionStatus::EXCEPTION;
+  }
+  // 6. If returnMethod is undefined, then
+  //   a. Return CreateIteratorResultObject(undefined, true).
+  if (returnMethodRes->get().isUndefined()) {
+    return createIterResultObject(runtime, Runtime::getUndefinedValue(), true)
+        .getHermesValue();
+  }
+  // 7. Return ? Call(returnMethod, iterator).
+  return Callable::executeCall0(
+             runtime.makeHandle<Callable>(std::move(*returnMethodRes)),
+             runtime,
+             lv.iterator)
+      .toCallResultHermesValue();
+}
+
+} // namespace vm
+} // namespace hermes
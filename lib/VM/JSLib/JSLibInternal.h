@@ -14,6 +14,7 @@
 #include "hermes/VM/JSError.h"
 #include "hermes/VM/JSMapImpl.h"
 #include "hermes/VM/JSNativeFunctions.h"
+#include "hermes/VM/JSPromise.h"
 #include "hermes/VM/JSProxy.h"
 #include "hermes/VM/JSRegExp.h"
 #include "hermes/VM/JSWeakRef.h"
@@ -365,6 +366,9 @@ HermesValue createWeakRefConstructor(Runtime &runtime);
 /// Create the FinalizationRegistry constructor and populate methods.
 HermesValue createFinalizationRegistryConstructor(Runtime &runtime);
 
+/// Create the Promise constructor and populate methods.
+HermesValue createPromiseConstructor(Runtime &runtime);
+
 /// Create the Symbol constructor and populate methods.
 void createSymbolConstructor(Runtime &runtime);
 
@@ -374,9 +378,18 @@ HermesValue createGeneratorFunctionConstructor(Runtime &runtime);
 /// Create the AsyncFunction constructor and populate methods.
 HermesValue createAsyncFunctionConstructor(Runtime &runtime);
 
+/// Register the native implementation of the spawnAsync builtin, which drives
+/// async functions on top of the native Promise.
+void registerAsyncFunctionDriver(Runtime &runtime);
+
 /// Create the IteratorPrototype.
 void populateIteratorPrototype(Runtime &runtime);
 
+/// Create the Iterator constructor, populate the iterator helper methods of
+/// the IteratorPrototype, and populate the IteratorHelper and
+/// WrapForValidIterator prototypes.
+HermesValue createIteratorConstructor(Runtime &runtime);
+
 /// Create the ArrayIterator prototype.
 void populateArrayIteratorPrototype(Runtime &runtime);
 
@@ -11,6 +11,7 @@
 //===----------------------------------------------------------------------===//
 #include "JSLibInternal.h"
 
+#include "hermes/VM/JSIteratorHelper.h"
 #include "hermes/VM/JSLib/JSLibStorage.h"
 #include "hermes/VM/Operations.h"
 #include "hermes/VM/SingleObject.h"
@@ -371,6 +372,241 @@ CallResult<HermesValue> mathSign(void *, Runtime &runtime) {
   return HermesValue::encodeTrustedNumberValue(std::signbit(x) ? -1 : +1);
 }
 
+namespace {
+
+/// Exact summation of doubles for Math.sumPrecise, following the reference
+/// implementation of the proposal (https://github.com/tc39/proposal-math-sum).
+/// It is Shewchuk's algorithm, as in Python's math.fsum: the sum is kept as a
+/// list of non-overlapping partials whose exact sum is the exact sum of the
+/// values added so far. Intermediate overflow is handled by an extra "biased"
+/// partial which counts multiples of 2**1024.
+class PreciseSum {
+ public:
+  /// Add \p x to the sum.
+  /// \return false if the sum overflowed beyond what can be represented.
+  bool add(double x);
+
+  /// \return the correctly rounded sum of the values added so far.
+  double result();
+
+ private:
+  /// 2**1023.
+  static constexpr double kTwoPow1023 = 0x1p1023;
+  /// The difference between the largest and the second largest doubles, i.e.
+  /// 2**(1023 - 52).
+  static constexpr double kMaxUlp = 0x1p971;
+
+  enum class State {
+    /// Only -0 values have been added.
+    LeadingZeros,
+    /// Finite values are being summed in partials_.
+    Finite,
+    /// A non-finite value has been added, and the result is nonFinite_.
+    NonFinite,
+  };
+
+  /// Set \p hi and \p lo to the rounded sum of \p x and \p y and its error.
+  /// \pre |x| >= |y|.
+  static void twoSum(double x, double y, double &hi, double &lo) {
+    hi = x + y;
+    lo = y - (hi - x);
+  }
+
+  State state_ = State::LeadingZeros;
+
+  /// The partials, in increasing order of magnitude.
+  llvh::SmallVector<double, 8> partials_{};
+
+  /// The sum is 2**1024 times this value, plus the sum of the partials.
+  double overflow_ = 0;
+
+  /// The result once a non-finite value has been added.
+  double nonFinite_ = 0;
+};
+
+bool PreciseSum::add(double x) {
+  switch (state_) {
+    case State::LeadingZeros:
+      if (x == 0 && std::signbit(x))
+        return true;
+      if (!std::isfinite(x)) {
+        nonFinite_ = x;
+        state_ = State::NonFinite;
+        return true;
+      }
+      partials_.push_back(x);
+      state_ = State::Finite;
+      return true;
+    case State::NonFinite:
+      // Summing two distinct non-finite values gives NaN, while summing one
+      // with itself gives itself.
+      if (!std::isfinite(x) && !(std::isnan(x) && std::isnan(nonFinite_)) &&
+          x != nonFinite_) {
+        nonFinite_ = std::numeric_limits<double>::quiet_NaN();
+      }
+      return true;
+    case State::Finite:
+      break;
+  }
+
+  if (!std::isfinite(x)) {
+    nonFinite_ = x;
+    state_ = State::NonFinite;
+    return true;
+  }
+
+  // Update the partials in place, keeping the non-zero rounding errors.
+  size_t used = 0;
+  for (size_t i = 0, e = partials_.size(); i < e; ++i) {
+    double y = partials_[i];
+    if (std::fabs(x) < std::fabs(y))
+      std::swap(x, y);
+    double hi, lo;
+    twoSum(x, y, hi, lo);
+    if (std::isinf(hi)) {
+      double sign = hi > 0 ? 1 : -1;
+      overflow_ += sign;
+      if (std::fabs(overflow_) >= 0x1p53)
+        return false;
+      x = (x - sign * kTwoPow1023) - sign * kTwoPow1023;
+      if (std::fabs(x) < std::fabs(y))
+        std::swap(x, y);
+      twoSum(x, y, hi, lo);
+    }
+    if (lo != 0)
+      partials_[used++] = lo;
+    x = hi;
+  }
+  partials_.resize(used);
+  if (x != 0)
+    partials_.push_back(x);
+  return true;
+}
+
+double PreciseSum::result() {
+  constexpr double inf = std::numeric_limits<double>::infinity();
+  if (state_ == State::LeadingZeros)
+    return -0.0;
+  if (state_ == State::NonFinite)
+    return nonFinite_;
+
+  // Compute the exact sum of the partials, stopping once precision is lost.
+  ptrdiff_t n = (ptrdiff_t)partials_.size() - 1;
+  double hi = 0;
+  double lo = 0;
+
+  if (overflow_ != 0) {
+    double next = n >= 0 ? partials_[n] : 0;
+    --n;
+    if (std::fabs(overflow_) > 1 || (overflow_ > 0 && next > 0) ||
+        (overflow_ < 0 && next < 0)) {
+      return overflow_ > 0 ? inf : -inf;
+    }
+    // Drop a factor of 2 so the arithmetic cannot overflow.
+    twoSum(overflow_ * kTwoPow1023, next / 2, hi, lo);
+    lo *= 2;
+    if (std::isinf(2 * hi)) {
+      // Subtracting exactly half an ulp from 2**1024 rounds to infinity under
+      // ties-to-even, unless the next partial has the opposite sign, in which
+      // case the result rounds to the largest double instead.
+      if (hi > 0) {
+        if (hi == kTwoPow1023 && lo == -(kMaxUlp / 2) && n >= 0 &&
+            partials_[n] < 0) {
+          return DBL_MAX;
+        }
+        return inf;
+      }
+      if (hi == -kTwoPow1023 && lo == (kMaxUlp / 2) && n >= 0 &&
+          partials_[n] > 0) {
+        return -DBL_MAX;
+      }
+      return -inf;
+    }
+    if (lo != 0) {
+      assert(n + 1 >= 0 && "a non-zero error requires a partial");
+      partials_[n + 1] = lo;
+      ++n;
+      lo = 0;
+    }
+    hi *= 2;
+  }
+
+  while (n >= 0) {
+    double x = hi;
+    double y = partials_[n];
+    --n;
+    twoSum(x, y, hi, lo);
+    if (lo != 0)
+      break;
+  }
+
+  // When the rounding error is exactly half an ulp of the result, the next
+  // partial decides which way to round.
+  if (n >= 0 &&
+      ((lo < 0 && partials_[n] < 0) || (lo > 0 && partials_[n] > 0))) {
+    double y = lo * 2;
+    double x = hi + y;
+    double yr = x - hi;
+    if (y == yr)
+      hi = x;
+  }
+
+  return hi;
+}
+
+} // namespace
+
+// ES2026 21.3.2.34 Math.sumPrecise ( items )
+CallResult<HermesValue> mathSumPrecise(void *, Runtime &runtime) {
+  NativeArgs args = runtime.getCurrentFrame().getNativeArgs();
+  GCScope gcScope{runtime};
+
+  // 1. Perform ? RequireObjectCoercible(items).
+  if (LLVM_UNLIKELY(args.getArg(0).isUndefined() || args.getArg(0).isNull()))
+    return runtime.raiseTypeError("Math.sumPrecise requires an iterable");
+
+  // 2. Let iteratorRecord be ? GetIterator(items, sync).
+  auto iterRes = getCheckedIterator(runtime, args.getArgHandle(0));
+  if (LLVM_UNLIKELY(iterRes == ExecutionStatus::EXCEPTION))
+    return ExecutionStatus::EXCEPTION;
+  Handle<JSObject> iterator = iterRes->iterator;
+  Handle<Callable> nextMethod = iterRes->nextMethod;
+
+  struct : public Locals {
+    PinnedValue<> value;
+  } lv;
+  LocalsRAII lraii{runtime, &lv};
+
+  PreciseSum sum{};
+  auto marker = gcScope.createMarker();
+  // 5. Let next be NOT-STARTED.
+  // 6. Repeat, while next is not DONE,
+  for (;;) {
+    gcScope.flushToMarker(marker);
+    // a. Set next to ? IteratorStepValue(iteratorRecord).
+    // Array iterators are stepped without allocating result objects.
+    auto stepRes =
+        iteratorStepValueDirect(runtime, iterator, nextMethod, &lv.value);
+    if (LLVM_UNLIKELY(stepRes == ExecutionStatus::EXCEPTION))
+      return ExecutionStatus::EXCEPTION;
+    if (!*stepRes)
+      break;
+    // b.iii. If next is not a Number, then
+    if (LLVM_UNLIKELY(!lv.value->isNumber())) {
+      // 1. Let error be ThrowCompletion(a newly created TypeError object).
+      // 2. Return ? IteratorClose(iteratorRecord, error).
+      (void)runtime.raiseTypeError("Math.sumPrecise expects numbers");
+      return iteratorCloseAndRethrow(runtime, iterator);
+    }
+    if (LLVM_UNLIKELY(!sum.add(lv.value->getNumber()))) {
+      (void)runtime.raiseRangeError("Math.sumPrecise overflow");
+      return iteratorCloseAndRethrow(runtime, iterator);
+    }
+  }
+
+  return HermesValue::encodeTrustedNumberValue(sum.result());
+}
+
 HermesValue createMathObject(Runtime &runtime) {
   struct : public Locals {
     PinnedValue<> numberHandle;
@@ -532,6 +768,13 @@ HermesValue createMathObject(Runtime &runtime) {
       Predefined::getSymbolID(Predefined::sinh), MathKind::sinh);
   setMathFunctionProperty1Arg(
       Predefined::getSymbolID(Predefined::sqrt), MathKind::sqrt);
+  defineMethod(
+      runtime,
+      lv.math,
+      Predefined::getSymbolID(Predefined::sumPrecise),
+      nullptr,
+      mathSumPrecise,
+      1);
   setMathFunctionProperty1Arg(
       Predefined::getSymbolID(Predefined::tan), MathKind::tan);
   setMathFunctionProperty1Arg(
@@ -0,0 +1,1095 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+//===----------------------------------------------------------------------===//
+/// \file
+/// ES2024 27.2 Initialize the Promise constructor.
+//===----------------------------------------------------------------------===//
+
+#include "JSLibInternal.h"
+#include "hermes/VM/JSArray.h"
+#include "hermes/VM/JSNativeFunctions.h"
+#include "hermes/VM/JSPromise.h"
+#include "hermes/VM/Operations.h"
+#include "hermes/VM/Runtime.h"
+#include "hermes/VM/StackFrame-inline.h"
+
+namespace hermes {
+namespace vm {
+
+//===----------------------------------------------------------------------===//
+
+HermesValue createPromiseConstructor(Runtime &runtime) {
+  auto promisePrototype = Handle<JSObject>::vmcast(&runtime.promisePrototype);
+
+  struct : public Locals {
+    PinnedValue<NativeConstructor> cons;
+  } lv;
+  LocalsRAII lraii(runtime, &lv);
+
+  defineSystemConstructor(
+      runtime,
+      Predefined::getSymbolID(Predefined::Promise),
+      promiseConstructor,
+      promisePrototype,
+      1,
+      lv.cons);
+
+  // Promise.prototype.xxx() methods.
+  defineMethod(
+      runtime,
+      promisePrototype,
+      Predefined::getSymbolID(Predefined::then),
+      nullptr,
+      promisePrototypeThen,
+      2);
+  defineMethod(
+      runtime,
+      promisePrototype,
+      Predefined::getSymbolID(Predefined::catchStr),
+      nullptr,
+      promisePrototypeCatch,
+      1);
+  defineMethod(
+      runtime,
+      promisePrototype,
+      Predefined::getSymbolID(Predefined::finally),
+      nullptr,
+      promisePrototypeFinally,
+      1);
+
+  DefinePropertyFlags dpf = DefinePropertyFlags::getDefaultNewPropertyFlags();
+  dpf.writable = 0;
+  dpf.enumerable = 0;
+  dpf.configurable = 1;
+
+  // 27.2.5.5 Promise.prototype [ @@toStringTag ]
+  // The initial value is the String value "Promise".
+  defineProperty(
+      runtime,
+      promisePrototype,
+      Predefined::getSymbolID(Predefined::SymbolToStringTag),
+      runtime.getPredefinedStringHandle(Predefined::Promise),
+      dpf);
+
+  // Promise.xxx() static methods.
+  defineMethod(
+      runtime,
+      lv.cons,
+      Predefined::getSymbolID(Predefined::all),
+      nullptr,
+      promiseAll,
+      1);
+  defineMethod(
+      runtime,
+      lv.cons,
+      Predefined::getSymbolID(Predefined::allSettled),
+      nullptr,
+      promiseAllSettled,
+      1);
+  defineMethod(
+      runtime,
+      lv.cons,
+      Predefined::getSymbolID(Predefined::any),
+      nullptr,
+      promiseAny,
+      1);
+  defineMethod(
+      runtime,
+      lv.cons,
+      Predefined::getSymbolID(Predefined::race),
+      nullptr,
+      promiseRace,
+      1);
+  defineMethod(
+      runtime,
+      lv.cons,
+      Predefined::getSymbolID(Predefined::reject),
+      nullptr,
+      promiseReject,
+      1);
+  defineMethod(
+      runtime,
+      lv.cons,
+      Predefined::getSymbolID(Predefined::resolve),
+      nullptr,
+      promiseResolve,
+      1);
+  defineMethod(
+      runtime,
+      lv.cons,
+      Predefined::getSymbolID(Predefined::withResolvers),
+      nullptr,
+      promiseWithResolvers,
+      0);
+
+  return lv.cons.getHermesValue();
+}
+
+namespace {
+
+/// The combinators that iterate over promises, which share most of their
+/// implementation.
+enum class Combinator { All, AllSettled, Any, Race };
+
+/// Fields of the ArrayStorage holding the state shared by the element
+/// functions of Promise.all, Promise.allSettled and Promise.any: the values
+/// (or errors), the remainingElementsCount and the capability.
+enum CombinatorField { StateValues, StateRemaining, StateCapability, StateCount };
+
+/// Additional slots of the element functions. The state is cleared when the
+/// function is called, which implements [[AlreadyCalled]]; the two functions
+/// of a Promise.allSettled element share it through the sibling slot.
+enum ElementSlot { ElementState, ElementIndex, ElementSibling, ElementCount };
+
+/// Additional slots of the thenFinally and catchFinally functions.
+enum FinallySlot { FinallyOnFinally, FinallyConstructor, FinallyCount };
+
+/// Additional slot of the valueThunk and thrower functions.
+enum ThunkSlot { ThunkValue, ThunkCount };
+
+/// Create an anonymous built-in function with \p slotCount additional slots,
+/// all initialized to undefined.
+Handle<NativeFunction> createClosure(
+    Runtime &runtime,
+    NativeFunctionPtr functionPtr,
+    unsigned paramCount,
+    unsigned slotCount) {
+  auto fn = NativeFunction::create(
+      runtime,
+      Handle<JSObject>::vmcast(&runtime.functionPrototype),
+      Runtime::makeNullHandle<Environment>(),
+      nullptr,
+      functionPtr,
+      Predefined::getSymbolID(Predefined::emptyString),
+      paramCount,
+      Runtime::makeNullHandle<JSObject>(),
+      slotCount);
+  for (unsigned i = 0; i < slotCount; ++i) {
+    NativeFunction::setAdditionalSlotValue(
+        *fn, runtime, i, SmallHermesValue::encodeUndefinedValue());
+  }
+  return fn;
+}
+
+/// \return the value of the additional slot \p index of the native function
+/// that is being called.
+HermesValue getCalleeSlot(Runtime &runtime, unsigned index) {
+  auto *self = vmcast<NativeFunction>(
+      runtime.getCurrentFrame()->getCalleeClosureUnsafe());
+  return NativeFunction::getAdditionalSlotValue(self, runtime, index)
+      .unboxToHV(runtime);
+}
+
+/// ES2024 27.2.1.1.1 IfAbruptRejectPromise(value, capability) for the value
+/// that was just thrown.
+CallResult<HermesValue> ifAbruptRejectPromise(
+    Runtime &runtime,
+    Handle<> capability) {
+  if (LLVM_UNLIKELY(
+          JSPromise::rejectCapabilityWithThrownValue(runtime, capability) ==
+          ExecutionStatus::EXCEPTION)) {
+    return ExecutionStatus::EXCEPTION;
+  }
+  return JSPromise::capabilityPromise(*capability);
+}
+
+/// ES2024 7.3.21 Invoke(value, "then", « onFulfilled, onRejected »), with
+/// only one argument if \p onRejected is None.
+/// \param discardResult whether the caller ignores the result. If it does,
+///   \p value is a native promise with the intrinsic "then", and its species
+///   is %Promise%, the derived promise is unobservable and isn't created.
+///   The handlers must then not throw.
+CallResult<HermesValue> invokeThen(
+    Runtime &runtime,
+    Handle<> value,
+    Handle<> onFulfilled,
+    llvh::Optional<Handle<>> onRejected,
+    bool discardResult = false) {
+  struct : public Locals {
+    PinnedValue<JSObject> obj;
+    PinnedValue<Callable> then;
+    PinnedValue<> capability;
+  } lv;
+  LocalsRAII lraii(runtime, &lv);
+
+  // 1. Let func be ? GetV(V, P).
+  auto objRes = toObject(runtime, value);
+  if (LLVM_UNLIKELY(objRes == ExecutionStatus::EXCEPTION))
+    return ExecutionStatus::EXCEPTION;
+  lv.obj.castAndSetHermesValue<JSObject>(*objRes);
+  auto thenRes = JSObject::getNamed_RJS(
+      lv.obj, runtime, Predefined::getSymbolID(Predefined::then));
+  if (LLVM_UNLIKELY(thenRes == ExecutionStatus::EXCEPTION))
+    return ExecutionStatus::EXCEPTION;
+  if (LLVM_UNLIKELY(!vmisa<Callable>(thenRes->get())))
+    return runtime.raiseTypeError("then is not a function");
+  lv.then.castAndSetHermesValue<Callable>(thenRes->get());
+
+  auto *thenFn = dyn_vmcast<NativeFunction>(*lv.then);
+  if (discardResult && vmisa<JSPromise>(*value) && thenFn &&
+      thenFn->getFunctionPtr() == promisePrototypeThen) {
+    // The steps of Promise.prototype.then, knowing the receiver.
+    auto promise = Handle<JSPromise>::vmcast(value);
+    auto consRes = JSPromise::speciesConstructor(runtime, promise);
+    if (LLVM_UNLIKELY(consRes == ExecutionStatus::EXCEPTION))
+      return ExecutionStatus::EXCEPTION;
+    if (consRes->getRaw() !=
+        runtime.promiseConstructor.getHermesValue().getRaw()) {
+      lv.capability = *consRes;
+      auto capRes = JSPromise::newPromiseCapability(runtime, lv.capability);
+      if (LLVM_UNLIKELY(capRes == ExecutionStatus::EXCEPTION))
+        return ExecutionStatus::EXCEPTION;
+      lv.capability = *capRes;
+    }
+    if (LLVM_UNLIKELY(
+            JSPromise::performThen(
+                runtime,
+                promise,
+                onFulfilled,
+                onRejected ? *onRejected : Runtime::getUndefinedValue(),
+                lv.capability) == ExecutionStatus::EXCEPTION)) {
+      return ExecutionStatus::EXCEPTION;
+    }
+    return HermesValue::encodeUndefinedValue();
+  }
+
+  // 3. Return ? Call(func, V, argumentsList).
+  auto callRes = onRejected ? Callable::executeCall2(
+                                  lv.then,
+                                  runtime,
+                                  value,
+                                  *onFulfilled,
+                                  onRejected->getHermesValue())
+                            : Callable::executeCall1(
+                                  lv.then, runtime, value, *onFulfilled);
+  if (LLVM_UNLIKELY(callRes == ExecutionStatus::EXCEPTION))
+    return ExecutionStatus::EXCEPTION;
+  return callRes->get();
+}
+
+/// ES2024 27.2.1.3.1 Promise Reject Functions and 27.2.1.3.2 Promise Resolve
+/// Functions.
+CallResult<HermesValue> resolvingFunction(Runtime &runtime, bool isReject) {
+  NativeArgs args = runtime.getCurrentFrame().getNativeArgs();
+  auto *self = vmcast<NativeFunction>(
+      runtime.getCurrentFrame()->getCalleeClosureUnsafe());
+
+  // 3-5. If alreadyResolved.[[Value]] is true, return undefined.
+  SmallHermesValue promise = NativeFunction::getAdditionalSlotValue(
+      self, runtime, JSPromise::RFPromise);
+  if (promise.isUndefined())
+    return HermesValue::encodeUndefinedValue();
+
+  // 6. Set alreadyResolved.[[Value]] to true.
+  auto *sibling = vmcast<NativeFunction>(
+      NativeFunction::getAdditionalSlotValue(
+          self, runtime, JSPromise::RFSibling)
+          .getObject(runtime));
+  NativeFunction::setAdditionalSlotValue(
+      self,
+      runtime,
+      JSPromise::RFPromise,
+      SmallHermesValue::encodeUndefinedValue());
+  NativeFunction::setAdditionalSlotValue(
+      sibling,
+      runtime,
+      JSPromise::RFPromise,
+      SmallHermesValue::encodeUndefinedValue());
+
+  struct : public Locals {
+    PinnedValue<JSPromise> promise;
+  } lv;
+  LocalsRAII lraii(runtime, &lv);
+  lv.promise.castAndSetHermesValue<JSPromise>(promise.unboxToHV(runtime));
+
+  auto status = isReject
+      ? JSPromise::reject(runtime, lv.promise, args.getArgHandle(0))
+      : JSPromise::resolve(runtime, lv.promise, args.getArgHandle(0));
+  if (LLVM_UNLIKELY(status == ExecutionStatus::EXCEPTION))
+    return ExecutionStatus::EXCEPTION;
+  return HermesValue::encodeUndefinedValue();
+}
+
+/// ES2024 27.2.5.3.1 Then Finally Functions and 27.2.5.3.2 Catch Finally
+/// Functions.
+CallResult<HermesValue> finallyFunction(Runtime &runtime, bool isReject) {
+  NativeArgs args = runtime.getCurrentFrame().getNativeArgs();
+  struct : public Locals {
+    PinnedValue<Callable> onFinally;
+    PinnedValue<> C;
+    PinnedValue<> result;
+    PinnedValue<NativeFunction> thunk;
+  } lv;
+  LocalsRAII lraii(runtime, &lv);
+  lv.onFinally.castAndSetHermesValue<Callable>(
+      getCalleeSlot(runtime, FinallyOnFinally));
+  lv.C = getCalleeSlot(runtime, FinallyConstructor);
+
+  // i. Let result be ? Call(onFinally, undefined).
+  auto callRes = Callable::executeCall0(
+      lv.onFinally, runtime, Runtime::getUndefinedValue());
+  if (LLVM_UNLIKELY(callRes == ExecutionStatus::EXCEPTION))
+    return ExecutionStatus::EXCEPTION;
+  lv.result = std::move(*callRes);
+
+  // ii. Let p be ? PromiseResolve(C, result).
+  auto pRes = JSPromise::promiseResolve(runtime, lv.C, lv.result);
+  if (LLVM_UNLIKELY(pRes == ExecutionStatus::EXCEPTION))
+    return ExecutionStatus::EXCEPTION;
+  lv.result = *pRes;
+
+  // iii. Let returnValue (or throwReason) be a new Abstract Closure that
+  //      captures value (or reason).
+  // iv. Let valueThunk (or thrower) be CreateBuiltinFunction(..., 0, "", « »).
+  lv.thunk = createClosure(
+      runtime, isReject ? promiseThrower : promiseValueThunk, 0, ThunkCount);
+  auto value = SmallHermesValue::encodeHermesValue(args.getArg(0), runtime);
+  NativeFunction::setAdditionalSlotValue(*lv.thunk, runtime, ThunkValue, value);
+
+  // v. Return ? Invoke(p, "then", « valueThunk »).
+  return invokeThen(runtime, lv.result, lv.thunk, llvh::None);
+}
+
+/// Decrement remainingElementsCount in \p state. When it reaches zero, resolve
+/// the capability with the values, or for Promise.any, reject it with an
+/// AggregateError of the errors.
+ExecutionStatus decrementRemainingElements(
+    Runtime &runtime,
+    Combinator kind,
+    Handle<ArrayStorage> state) {
+  double remaining = state->at(StateRemaining).getNumber() - 1;
+  state->set(
+      StateRemaining,
+      HermesValue::encodeTrustedNumberValue(remaining),
+      runtime.getHeap());
+  if (remaining != 0)
+    return ExecutionStatus::RETURNED;
+
+  struct : public Locals {
+    PinnedValue<> capability;
+    PinnedValue<> values;
+    PinnedValue<JSError> error;
+  } lv;
+  LocalsRAII lraii(runtime, &lv);
+  lv.capability = state->at(StateCapability);
+  lv.values = state->at(StateValues);
+
+  if (kind != Combinator::Any) {
+    // Perform ? Call(resultCapability.[[Resolve]], undefined,
+    // « valuesArray »).
+    return JSPromise::settleCapability(
+        runtime, lv.capability, lv.values, false);
+  }
+
+  // a. Let error be a newly created AggregateError object.
+  lv.error = JSError::create(
+      runtime, Handle<JSObject>::vmcast(&runtime.AggregateErrorPrototype));
+  if (LLVM_UNLIKELY(
+          JSError::recordStackTrace(lv.error, runtime) ==
+          ExecutionStatus::EXCEPTION)) {
+    return ExecutionStatus::EXCEPTION;
+  }
+  auto message = StringPrimitive::createNoThrow(
+      runtime, "All promises were rejected");
+  if (LLVM_UNLIKELY(
+          JSError::setMessage(lv.error, runtime, message) ==
+          ExecutionStatus::EXCEPTION)) {
+    return ExecutionStatus::EXCEPTION;
+  }
+  // b. Perform ! DefinePropertyOrThrow(error, "errors", PropertyDescriptor {
+  //    [[Configurable]]: true, [[Enumerable]]: false, [[Writable]]: true,
+  //    [[Value]]: CreateArrayFromList(errors) }).
+  if (LLVM_UNLIKELY(
+          JSObject::defineOwnProperty(
+              lv.error,
+              runtime,
+              Predefined::getSymbolID(Predefined::errors),
+              DefinePropertyFlags::getNewNonEnumerableFlags(),
+              lv.values) == ExecutionStatus::EXCEPTION)) {
+    return ExecutionStatus::EXCEPTION;
+  }
+  // c. Return ThrowCompletion(error).
+  lv.values = lv.error.getHermesValue();
+  return JSPromise::settleCapability(runtime, lv.capability, lv.values, true);
+}
+
+/// The element functions of the combinators: ES2024 27.2.4.1.3
+/// Promise.all Resolve Element Functions, 27.2.4.2.2 Promise.allSettled
+/// Resolve Element Functions, 27.2.4.2.3 Promise.allSettled Reject Element
+/// Functions and 27.2.4.3.2 Promise.any Reject Element Functions.
+CallResult<HermesValue>
+elementFunction(Runtime &runtime, Combinator kind, bool isReject) {
+  NativeArgs args = runtime.getCurrentFrame().getNativeArgs();
+  auto *self = vmcast<NativeFunction>(
+      runtime.getCurrentFrame()->getCalleeClosureUnsafe());
+
+  // 1-3. If alreadyCalled.[[Value]] is true, return undefined.
+  SmallHermesValue state =
+      NativeFunction::getAdditionalSlotValue(self, runtime, ElementState);
+  if (state.isUndefined())
+    return HermesValue::encodeUndefinedValue();
+
+  // 4. Set alreadyCalled.[[Value]] to true.
+  uint32_t index =
+      NativeFunction::getAdditionalSlotValue(self, runtime, ElementIndex)
+          .unboxToHV(runtime)
+          .getNumberAs<uint32_t>();
+  SmallHermesValue sibling =
+      NativeFunction::getAdditionalSlotValue(self, runtime, ElementSibling);
+  NativeFunction::setAdditionalSlotValue(
+      self, runtime, ElementState, SmallHermesValue::encodeUndefinedValue());
+  if (sibling.isObject()) {
+    NativeFunction::setAdditionalSlotValue(
+        vmcast<NativeFunction>(sibling.getObject(runtime)),
+        runtime,
+        ElementState,
+        SmallHermesValue::encodeUndefinedValue());
+  }
+
+  struct : public Locals {
+    PinnedValue<ArrayStorage> state;
+    PinnedValue<JSArray> values;
+    PinnedValue<JSObject> obj;
+    PinnedValue<> x;
+  } lv;
+  LocalsRAII lraii(runtime, &lv);
+  lv.state.castAndSetHermesValue<ArrayStorage>(state.unboxToHV(runtime));
+  lv.values.castAndSetHermesValue<JSArray>(lv.state->at(StateValues));
+  lv.x = args.getArg(0);
+
+  if (kind == Combinator::AllSettled) {
+    // Let obj be OrdinaryObjectCreate(%Object.prototype%).
+    lv.obj = JSObject::create(runtime);
+    // Perform ! CreateDataPropertyOrThrow(obj, "status", "fulfilled" or
+    // "rejected").
+    auto status = runtime.getPredefinedStringHandle(
+        isReject ? Predefined::rejected : Predefined::fulfilled);
+    if (LLVM_UNLIKELY(
+            JSObject::defineOwnProperty(
+                lv.obj,
+                runtime,
+                Predefined::getSymbolID(Predefined::status),
+                DefinePropertyFlags::getDefaultNewPropertyFlags(),
+                status) == ExecutionStatus::EXCEPTION)) {
+      return ExecutionStatus::EXCEPTION;
+    }
+    // Perform ! CreateDataPropertyOrThrow(obj, "value" or "reason", x).
+    if (LLVM_UNLIKELY(
+            JSObject::defineOwnProperty(
+                lv.obj,
+                runtime,
+                Predefined::getSymbolID(
+                    isReject ? Predefined::reason : Predefined::value),
+                DefinePropertyFlags::getDefaultNewPropertyFlags(),
+                lv.x) == ExecutionStatus::EXCEPTION)) {
+      return ExecutionStatus::EXCEPTION;
+    }
+    lv.x = lv.obj.getHermesValue();
+  }
+
+  // Set values[index] to x (or obj, or errors[index] to x).
+  if (LLVM_UNLIKELY(
+          JSArray::setElementAt(lv.values, runtime, index, lv.x) ==
+          ExecutionStatus::EXCEPTION)) {
+    return ExecutionStatus::EXCEPTION;
+  }
+
+  // Set remainingElementsCount.[[Value]] to
+  // remainingElementsCount.[[Value]] - 1, and settle the capability if it is
+  // 0.
+  if (LLVM_UNLIKELY(
+          decrementRemainingElements(runtime, kind, lv.state) ==
+          ExecutionStatus::EXCEPTION)) {
+    return ExecutionStatus::EXCEPTION;
+  }
+  return HermesValue::encodeUndefinedValue();
+}
+
+/// ES2024 27.2.4.1.1 PerformPromiseAll and its counterparts for allSettled,
+/// any and race, which only differ in the handlers passed to "then" and in
+/// how the end of the iteration is handled.
+/// \param[out] done set to true if the iterator threw or completed, in which
+///   case it must not be closed.
+ExecutionStatus performCombinator(
+    Runtime &runtime,
+    Combinator kind,
+    const CheckedIteratorRecord &iteratorRecord,
+    Handle<> C,
+    Handle<> capability,
+    Handle<Callable> promiseResolve,
+    bool &done) {
+  struct : public Locals {
+    PinnedValue<ArrayStorage> state;
+    PinnedValue<JSArray> values;
+    PinnedValue<> next;
+    PinnedValue<> nextPromise;
+    PinnedValue<> onFulfilled;
+    PinnedValue<> onRejected;
+    PinnedValue<NativeFunction> element;
+    PinnedValue<NativeFunction> sibling;
+  } lv;
+  LocalsRAII lraii(runtime, &lv);
+
+  // The capability functions of %Promise% are resolving functions, which
+  // don't throw, and neither do the element functions. So "then" can skip
+  // the derived promises, which are unobservable.
+  bool handlersCantThrow =
+      C->getRaw() == runtime.promiseConstructor.getHermesValue().getRaw();
+
+  if (kind != Combinator::Race) {
+    // 1. Let values be a new empty List.
+    auto arrRes = JSArray::create(runtime, 0, 0);
+    if (LLVM_UNLIKELY(arrRes == ExecutionStatus::EXCEPTION))
+      return ExecutionStatus::EXCEPTION;
+    lv.values = std::move(*arrRes);
+    // 2. Let remainingElementsCount be the Record { [[Value]]: 1 }.
+    auto stateRes = ArrayStorage::create(runtime, StateCount);
+    if (LLVM_UNLIKELY(stateRes == ExecutionStatus::EXCEPTION))
+      return ExecutionStatus::EXCEPTION;
+    lv.state.castAndSetHermesValue<ArrayStorage>(*stateRes);
+    GC &heap = runtime.getHeap();
+    ArrayStorage::resizeWithinCapacity(*lv.state, heap, StateCount);
+    lv.state->set(StateValues, lv.values.getHermesValue(), heap);
+    lv.state->set(
+        StateRemaining, HermesValue::encodeTrustedNumberValue(1), heap);
+    lv.state->set(StateCapability, *capability, heap);
+  }
+
+  // 3. Let index be 0.
+  // 4. Repeat,
+  for (uint32_t index = 0;; ++index) {
+    GCScopeMarkerRAII marker{runtime};
+
+    // a. Let next be ? IteratorStepValue(iteratorRecord).
+    auto stepRes = iteratorStepValue(runtime, iteratorRecord, &lv.next);
+    if (LLVM_UNLIKELY(stepRes == ExecutionStatus::EXCEPTION)) {
+      done = true;
+      return ExecutionStatus::EXCEPTION;
+    }
+    // b. If next is done, then
+    if (!*stepRes) {
+      done = true;
+      if (kind == Combinator::Race)
+        return ExecutionStatus::RETURNED;
+      // i. Set remainingElementsCount.[[Value]] to
+      //    remainingElementsCount.[[Value]] - 1.
+      // ii. If remainingElementsCount.[[Value]] = 0, then resolve (or reject)
+      //     the capability.
+      return decrementRemainingElements(runtime, kind, lv.state);
+    }
+
+    if (kind != Combinator::Race) {
+      // c. Append undefined to values.
+      if (LLVM_UNLIKELY(
+              JSArray::setElementAt(
+                  lv.values, runtime, index, Runtime::getUndefinedValue()) ==
+              ExecutionStatus::EXCEPTION)) {
+        return ExecutionStatus::EXCEPTION;
+      }
+      if (LLVM_UNLIKELY(
+              JSArray::setLengthProperty(lv.values, runtime, index + 1) ==
+              ExecutionStatus::EXCEPTION)) {
+        return ExecutionStatus::EXCEPTION;
+      }
+    }
+
+    // d. Let nextPromise be ? Call(promiseResolve, constructor, « next »).
+    auto nextRes =
+        Callable::executeCall1(promiseResolve, runtime, C, *lv.next);
+    if (LLVM_UNLIKELY(nextRes == ExecutionStatus::EXCEPTION))
+      return ExecutionStatus::EXCEPTION;
+    lv.nextPromise = std::move(*nextRes);
+
+    auto *cap = vmcast<ArrayStorage>(*capability);
+    lv.onFulfilled = cap->at(JSPromise::CapResolve);
+    lv.onRejected = cap->at(JSPromise::CapReject);
+    if (kind != Combinator::Race) {
+      // e-k. Create the element function(s) with index and the shared state.
+      NativeFunctionPtr elementFn = kind == Combinator::All
+          ? promiseAllResolveElement
+          : kind == Combinator::AllSettled ? promiseAllSettledResolveElement
+                                           : promiseAnyRejectElement;
+      lv.element = createClosure(runtime, elementFn, 1, ElementCount);
+      auto stateSHV = SmallHermesValue::encodeObjectValue(*lv.state, runtime);
+      auto indexSHV = SmallHermesValue::encodeNumberValue(index, runtime);
+      NativeFunction::setAdditionalSlotValue(
+          *lv.element, runtime, ElementState, stateSHV);
+      NativeFunction::setAdditionalSlotValue(
+          *lv.element, runtime, ElementIndex, indexSHV);
+      if (kind == Combinator::AllSettled) {
+        lv.sibling = createClosure(
+            runtime, promiseAllSettledRejectElement, 1, ElementCount);
+        NativeFunction::setAdditionalSlotValue(
+            *lv.sibling, runtime, ElementState, stateSHV);
+        NativeFunction::setAdditionalSlotValue(
+            *lv.sibling, runtime, ElementIndex, indexSHV);
+        NativeFunction::setAdditionalSlotValue(
+            *lv.element,
+            runtime,
+            ElementSibling,
+            SmallHermesValue::encodeObjectValue(*lv.sibling, runtime));
+        NativeFunction::setAdditionalSlotValue(
+            *lv.sibling,
+            runtime,
+            ElementSibling,
+            SmallHermesValue::encodeObjectValue(*lv.element, runtime));
+        lv.onRejected = lv.sibling.getHermesValue();
+      }
+      if (kind == Combinator::Any)
+        lv.onRejected = lv.element.getHermesValue();
+      else
+        lv.onFulfilled = lv.element.getHermesValue();
+
+      // Set remainingElementsCount.[[Value]] to
+      // remainingElementsCount.[[Value]] + 1.
+      lv.state->set(
+          StateRemaining,
+          HermesValue::encodeTrustedNumberValue(
+              lv.state->at(StateRemaining).getNumber() + 1),
+          runtime.getHeap());
+    }
+
+    // Perform ? Invoke(nextPromise, "then", « onFulfilled, onRejected »).
+    if (LLVM_UNLIKELY(
+            invokeThen(
+                runtime,
+                lv.nextPromise,
+                lv.onFulfilled,
+                Handle<>(lv.onRejected),
+                handlersCantThrow) == ExecutionStatus::EXCEPTION)) {
+      return ExecutionStatus::EXCEPTION;
+    }
+  }
+}
+
+/// ES2024 27.2.4.1 Promise.all, 27.2.4.2 Promise.allSettled, 27.2.4.3
+/// Promise.any and 27.2.4.5 Promise.race.
+CallResult<HermesValue> promiseCombinator(Runtime &runtime, Combinator kind) {
+  NativeArgs args = runtime.getCurrentFrame().getNativeArgs();
+  struct : public Locals {
+    PinnedValue<> capability;
+    PinnedValue<Callable> promiseResolve;
+  } lv;
+  LocalsRAII lraii(runtime, &lv);
+
+  // 1. Let C be the this value.
+  Handle<> C = args.getThisHandle();
+  // 2. Let promiseCapability be ? NewPromiseCapability(C).
+  auto capRes = JSPromise::newPromiseCapability(runtime, C, true);
+  if (LLVM_UNLIKELY(capRes == ExecutionStatus::EXCEPTION))
+    return ExecutionStatus::EXCEPTION;
+  lv.capability = *capRes;
+
+  // 3. Let promiseResolve be Completion(GetPromiseResolve(C)).
+  // 4. IfAbruptRejectPromise(promiseResolve, promiseCapability).
+  auto resolveRes = JSObject::getNamed_RJS(
+      Handle<JSObject>::vmcast(C),
+      runtime,
+      Predefined::getSymbolID(Predefined::resolve));
+  if (LLVM_UNLIKELY(resolveRes == ExecutionStatus::EXCEPTION))
+    return ifAbruptRejectPromise(runtime, lv.capability);
+  if (LLVM_UNLIKELY(!vmisa<Callable>(resolveRes->get()))) {
+    (void)runtime.raiseTypeError("Promise resolve is not a function");
+    return ifAbruptRejectPromise(runtime, lv.capability);
+  }
+  lv.promiseResolve.castAndSetHermesValue<Callable>(resolveRes->get());
+
+  // 5. Let iteratorRecord be Completion(GetIterator(iterable, sync)).
+  // 6. IfAbruptRejectPromise(iteratorRecord, promiseCapability).
+  auto iterRes = getCheckedIterator(runtime, args.getArgHandle(0));
+  if (LLVM_UNLIKELY(iterRes == ExecutionStatus::EXCEPTION))
+    return ifAbruptRejectPromise(runtime, lv.capability);
+
+  // 7. Let result be Completion(PerformPromiseAll(iteratorRecord, C,
+  //    promiseCapability, promiseResolve)).
+  bool done = false;
+  if (LLVM_UNLIKELY(
+          performCombinator(
+              runtime,
+              kind,
+              *iterRes,
+              C,
+              lv.capability,
+              lv.promiseResolve,
+              done) == ExecutionStatus::EXCEPTION)) {
+    // 8. If result is an abrupt completion, then
+    //   a. If iteratorRecord.[[Done]] is false, set result to
+    //      Completion(IteratorClose(iteratorRecord, result)).
+    if (!done && !isUncatchableError(runtime.getThrownValue()))
+      (void)iteratorCloseAndRethrow(runtime, iterRes->iterator);
+    //   b. IfAbruptRejectPromise(result, promiseCapability).
+    return ifAbruptRejectPromise(runtime, lv.capability);
+  }
+  // 9. Return ? result.
+  return JSPromise::capabilityPromise(*lv.capability);
+}
+
+} // namespace
+
+// ES2024 27.2.3.1 Promise ( executor )
+CallResult<HermesValue> promiseConstructor(void *, Runtime &runtime) {
+  NativeArgs args = runtime.getCurrentFrame().getNativeArgs();
+  // 1. If NewTarget is undefined, throw a TypeError exception.
+  if (!args.isConstructorCall()) {
+    return runtime.raiseTypeError("Constructor Promise requires 'new'");
+  }
+  // 2. If IsCallable(executor) is false, throw a TypeError exception.
+  auto executor = args.dyncastArg<Callable>(0);
+  if (LLVM_UNLIKELY(!executor)) {
+    return runtime.raiseTypeError("Promise executor is not a function");
+  }
+
+  struct : public Locals {
+    PinnedValue<JSObject> selfParent;
+    PinnedValue<JSPromise> self;
+    PinnedValue<NativeFunction> resolve;
+    PinnedValue<NativeFunction> reject;
+    PinnedValue<> reason;
+  } lv;
+  LocalsRAII lraii(runtime, &lv);
+
+  // 3. Let promise be ? OrdinaryCreateFromConstructor(NewTarget,
+  //    "%Promise.prototype%", ...).
+  if (LLVM_LIKELY(
+          args.getNewTarget().getRaw() ==
+          runtime.promiseConstructor.getHermesValue().getRaw())) {
+    lv.selfParent = runtime.promisePrototype;
+  } else {
+    CallResult<PseudoHandle<JSObject>> thisParentRes =
+        NativeConstructor::parentForNewThis_RJS(
+            runtime,
+            Handle<Callable>::vmcast(&args.getNewTarget()),
+            runtime.promisePrototype);
+    if (LLVM_UNLIKELY(thisParentRes == ExecutionStatus::EXCEPTION)) {
+      return ExecutionStatus::EXCEPTION;
+    }
+    lv.selfParent = std::move(*thisParentRes);
+  }
+  lv.self = JSPromise::create(runtime, lv.selfParent);
+
+  // 8. Let resolvingFunctions be CreateResolvingFunctions(promise).
+  JSPromise::createResolvingFunctions(runtime, lv.self, lv.resolve, lv.reject);
+
+  // 9. Let completion be Completion(Call(executor, undefined,
+  //    « resolvingFunctions.[[Resolve]], resolvingFunctions.[[Reject]] »)).
+  auto callRes = Callable::executeCall2(
+      executor,
+      runtime,
+      Runtime::getUndefinedValue(),
+      lv.resolve.getHermesValue(),
+      lv.reject.getHermesValue());
+  // 10. If completion is an abrupt completion, then
+  //   a. Perform ? Call(resolvingFunctions.[[Reject]], undefined,
+  //      « completion.[[Value]] »).
+  if (LLVM_UNLIKELY(callRes == ExecutionStatus::EXCEPTION)) {
+    if (isUncatchableError(runtime.getThrownValue()))
+      return ExecutionStatus::EXCEPTION;
+    lv.reason = runtime.getThrownValue();
+    runtime.clearThrownValue();
+    auto rejectRes = Callable::executeCall1(
+        lv.reject, runtime, Runtime::getUndefinedValue(), *lv.reason);
+    if (LLVM_UNLIKELY(rejectRes == ExecutionStatus::EXCEPTION))
+      return ExecutionStatus::EXCEPTION;
+  }
+
+  // 11. Return promise.
+  return lv.self.getHermesValue();
+}
+
+// ES2024 27.2.5.4 Promise.prototype.then ( onFulfilled, onRejected )
+CallResult<HermesValue> promisePrototypeThen(void *, Runtime &runtime) {
+  NativeArgs args = runtime.getCurrentFrame().getNativeArgs();
+  // 1. Let promise be the this value.
+  // 2. If IsPromise(promise) is false, throw a TypeError exception.
+  auto promise = args.dyncastThis<JSPromise>();
+  if (LLVM_UNLIKELY(!promise)) {
+    return runtime.raiseTypeError(
+        "Promise.prototype.then() called on non-Promise object");
+  }
+
+  struct : public Locals {
+    PinnedValue<> C;
+    PinnedValue<> capability;
+  } lv;
+  LocalsRAII lraii(runtime, &lv);
+
+  // 3. Let C be ? SpeciesConstructor(promise, %Promise%).
+  auto consRes = JSPromise::speciesConstructor(runtime, promise);
+  if (LLVM_UNLIKELY(consRes == ExecutionStatus::EXCEPTION))
+    return ExecutionStatus::EXCEPTION;
+  lv.C = *consRes;
+
+  // 4. Let resultCapability be ? NewPromiseCapability(C).
+  auto capRes = JSPromise::newPromiseCapability(runtime, lv.C);
+  if (LLVM_UNLIKELY(capRes == ExecutionStatus::EXCEPTION))
+    return ExecutionStatus::EXCEPTION;
+  lv.capability = *capRes;
+
+  // 5. Return PerformPromiseThen(promise, onFulfilled, onRejected,
+  //    resultCapability).
+  if (LLVM_UNLIKELY(
+          JSPromise::performThen(
+              runtime,
+              promise,
+              args.getArgHandle(0),
+              args.getArgHandle(1),
+              lv.capability) == ExecutionStatus::EXCEPTION)) {
+    return ExecutionStatus::EXCEPTION;
+  }
+  return JSPromise::capabilityPromise(*lv.capability);
+}
+
+// ES2024 27.2.5.1 Promise.prototype.catch ( onRejected )
+CallResult<HermesValue> promisePrototypeCatch(void *, Runtime &runtime) {
+  NativeArgs args = runtime.getCurrentFrame().getNativeArgs();
+  // 2. Return ? Invoke(promise, "then", « undefined, onRejected »).
+  return invokeThen(
+      runtime,
+      args.getThisHandle(),
+      Runtime::getUndefinedValue(),
+      args.getArgHandle(0));
+}
+
+// ES2024 27.2.5.3 Promise.prototype.finally ( onFinally )
+CallResult<HermesValue> promisePrototypeFinally(void *, Runtime &runtime) {
+  NativeArgs args = runtime.getCurrentFrame().getNativeArgs();
+  // 1. Let promise be the this value.
+  // 2. If promise is not an Object, throw a TypeError exception.
+  auto promise = args.dyncastThis<JSObject>();
+  if (LLVM_UNLIKELY(!promise)) {
+    return runtime.raiseTypeError(
+        "Promise.prototype.finally() called on non-object");
+  }
+
+  struct : public Locals {
+    PinnedValue<> C;
+    PinnedValue<> thenFinally;
+    PinnedValue<> catchFinally;
+    PinnedValue<NativeFunction> fn;
+  } lv;
+  LocalsRAII lraii(runtime, &lv);
+
+  // 3. Let C be ? SpeciesConstructor(promise, %Promise%).
+  auto consRes = JSPromise::speciesConstructor(runtime, promise);
+  if (LLVM_UNLIKELY(consRes == ExecutionStatus::EXCEPTION))
+    return ExecutionStatus::EXCEPTION;
+  lv.C = *consRes;
+
+  auto onFinally = args.getArgHandle(0);
+  if (!vmisa<Callable>(*onFinally)) {
+    // 5. If IsCallable(onFinally) is false, then
+    //   a. Let thenFinally be onFinally.
+    //   b. Let catchFinally be onFinally.
+    lv.thenFinally = *onFinally;
+    lv.catchFinally = *onFinally;
+  } else {
+    // 6. Else,
+    //   a-b. Let thenFinally be CreateBuiltinFunction(thenFinallyClosure, 1,
+    //        "", « »).
+    //   c-d. Let catchFinally be CreateBuiltinFunction(catchFinallyClosure,
+    //        1, "", « »).
+    auto onFinallySHV =
+        SmallHermesValue::encodeHermesValue(*onFinally, runtime);
+    auto consSHV = SmallHermesValue::encodeHermesValue(*lv.C, runtime);
+    lv.fn = createClosure(runtime, promiseThenFinally, 1, FinallyCount);
+    NativeFunction::setAdditionalSlotValue(
+        *lv.fn, runtime, FinallyOnFinally, onFinallySHV);
+    NativeFunction::setAdditionalSlotValue(
+        *lv.fn, runtime, FinallyConstructor, consSHV);
+    lv.thenFinally = lv.fn.getHermesValue();
+    lv.fn = createClosure(runtime, promiseCatchFinally, 1, FinallyCount);
+    NativeFunction::setAdditionalSlotValue(
+        *lv.fn, runtime, FinallyOnFinally, onFinallySHV);
+    NativeFunction::setAdditionalSlotValue(
+        *lv.fn, runtime, FinallyConstructor, consSHV);
+    lv.catchFinally = lv.fn.getHermesValue();
+  }
+
+  // 7. Return ? Invoke(promise, "then", « thenFinally, catchFinally »).
+  return invokeThen(
+      runtime, args.getThisHandle(), lv.thenFinally, Handle<>(lv.catchFinally));
+}
+
+CallResult<HermesValue> promiseAll(void *, Runtime &runtime) {
+  return promiseCombinator(runtime, Combinator::All);
+}
+
+CallResult<HermesValue> promiseAllSettled(void *, Runtime &runtime) {
+  return promiseCombinator(runtime, Combinator::AllSettled);
+}
+
+CallResult<HermesValue> promiseAny(void *, Runtime &runtime) {
+  return promiseCombinator(runtime, Combinator::Any);
+}
+
+CallResult<HermesValue> promiseRace(void *, Runtime &runtime) {
+  return promiseCombinator(runtime, Combinator::Race);
+}
+
+// ES2024 27.2.4.6 Promise.reject ( r )
+CallResult<HermesValue> promiseReject(void *, Runtime &runtime) {
+  NativeArgs args = runtime.getCurrentFrame().getNativeArgs();
+  struct : public Locals {
+    PinnedValue<> capability;
+  } lv;
+  LocalsRAII lraii(runtime, &lv);
+
+  // 1. Let C be the this value.
+  // 2. Let promiseCapability be ? NewPromiseCapability(C).
+  auto capRes =
+      JSPromise::newPromiseCapability(runtime, args.getThisHandle());
+  if (LLVM_UNLIKELY(capRes == ExecutionStatus::EXCEPTION))
+    return ExecutionStatus::EXCEPTION;
+  lv.capability = *capRes;
+  // 3. Perform ? Call(promiseCapability.[[Reject]], undefined, « r »).
+  if (LLVM_UNLIKELY(
+          JSPromise::settleCapability(
+              runtime, lv.capability, args.getArgHandle(0), true) ==
+          ExecutionStatus::EXCEPTION)) {
+    return ExecutionStatus::EXCEPTION;
+  }
+  // 4. Return promiseCapability.[[Promise]].
+  return JSPromise::capabilityPromise(*lv.capability);
+}
+
+// ES2024 27.2.4.7 Promise.resolve ( x )
+CallResult<HermesValue> promiseResolve(void *, Runtime &runtime) {
+  NativeArgs args = runtime.getCurrentFrame().getNativeArgs();
+  // 1. Let C be the this value.
+  // 2. If C is not an Object, throw a TypeError exception.
+  if (LLVM_UNLIKELY(!args.getThisArg().isObject())) {
+    return runtime.raiseTypeError("Promise.resolve() called on non-object");
+  }
+  // 3. Return ? PromiseResolve(C, x).
+  return JSPromise::promiseResolve(
+      runtime, args.getThisHandle(), args.getArgHandle(0));
+}
+
+// ES2025 27.2.4.8 Promise.withResolvers ( )
+CallResult<HermesValue> promiseWithResolvers(void *, Runtime &runtime) {
+  NativeArgs args = runtime.getCurrentFrame().getNativeArgs();
+  struct : public Locals {
+    PinnedValue<ArrayStorage> capability;
+    PinnedValue<JSObject> obj;
+    PinnedValue<> field;
+  } lv;
+  LocalsRAII lraii(runtime, &lv);
+
+  // 1. Let C be the this value.
+  // 2. Let promiseCapability be ? NewPromiseCapability(C).
+  auto capRes =
+      JSPromise::newPromiseCapability(runtime, args.getThisHandle(), true);
+  if (LLVM_UNLIKELY(capRes == ExecutionStatus::EXCEPTION))
+    return ExecutionStatus::EXCEPTION;
+  lv.capability.castAndSetHermesValue<ArrayStorage>(*capRes);
+
+  // 3. Let obj be OrdinaryObjectCreate(%Object.prototype%).
+  lv.obj = JSObject::create(runtime);
+  // 4-6. Perform ! CreateDataPropertyOrThrow(obj, "promise", "resolve" and
+  //      "reject", ...).
+  static constexpr std::pair<Predefined::Str, JSPromise::CapabilityField>
+      fields[] = {
+          {Predefined::promise, JSPromise::CapPromise},
+          {Predefined::resolve, JSPromise::CapResolve},
+          {Predefined::reject, JSPromise::CapReject},
+      };
+  for (const auto &[name, index] : fields) {
+    lv.field = lv.capability->at(index);
+    if (LLVM_UNLIKELY(
+            JSObject::defineOwnProperty(
+                lv.obj,
+                runtime,
+                Predefined::getSymbolID(name),
+                DefinePropertyFlags::getDefaultNewPropertyFlags(),
+                lv.field) == ExecutionStatus::EXCEPTION)) {
+      return ExecutionStatus::EXCEPTION;
+    }
+  }
+  // 7. Return obj.
+  return lv.obj.getHermesValue();
+}
+
+CallResult<HermesValue> promiseResolveFunction(void *, Runtime &runtime) {
+  return resolvingFunction(runtime, false);
+}
+
+CallResult<HermesValue> promiseRejectFunction(void *, Runtime &runtime) {
+  return resolvingFunction(runtime, true);
+}
+
+// ES2024 27.2.1.5 NewPromiseCapability, GetCapabilitiesExecutor Functions.
+CallResult<HermesValue> promiseCapabilityExecutor(void *, Runtime &runtime) {
+  NativeArgs args = runtime.getCurrentFrame().getNativeArgs();
+  auto *self = vmcast<NativeFunction>(
+      runtime.getCurrentFrame()->getCalleeClosureUnsafe());
+  // a. If resolvingFunctions.[[Resolve]] is not undefined, throw a TypeError
+  //    exception.
+  // b. If resolvingFunctions.[[Reject]] is not undefined, throw a TypeError
+  //    exception.
+  if (!NativeFunction::getAdditionalSlotValue(
+           self, runtime, JSPromise::ExecutorResolve)
+           .isUndefined() ||
+      !NativeFunction::getAdditionalSlotValue(
+           self, runtime, JSPromise::ExecutorReject)
+           .isUndefined()) {
+    return runtime.raiseTypeError(
+        "Promise executor has already been invoked with non-undefined "
+        "arguments");
+  }
+  // c. Set resolvingFunctions.[[Resolve]] to resolve.
+  // d. Set resolvingFunctions.[[Reject]] to reject.
+  auto resolve = SmallHermesValue::encodeHermesValue(args.getArg(0), runtime);
+  NativeFunction::setAdditionalSlotValue(
+      self, runtime, JSPromise::ExecutorResolve, resolve);
+  auto reject = SmallHermesValue::encodeHermesValue(args.getArg(1), runtime);
+  NativeFunction::setAdditionalSlotValue(
+      self, runtime, JSPromise::ExecutorReject, reject);
+  // e. Return undefined.
+  return HermesValue::encodeUndefinedValue();
+}
+
+CallResult<HermesValue> promiseThenFinally(void *, Runtime &runtime) {
+  return finallyFunction(runtime, false);
+}
+
+CallResult<HermesValue> promiseCatchFinally(void *, Runtime &runtime) {
+  return finallyFunction(runtime, true);
+}
+
+CallResult<HermesValue> promiseValueThunk(void *, Runtime &runtime) {
+  // 1. Return value.
+  return getCalleeSlot(runtime, ThunkValue);
+}
+
+CallResult<HermesValue> promiseThrower(void *, Runtime &runtime) {
+  // 1. Return ThrowCompletion(reason).
+  return runtime.setThrownValue(getCalleeSlot(runtime, ThunkValue));
+}
+
+CallResult<HermesValue> promiseAllResolveElement(void *, Runtime &runtime) {
+  return elementFunction(runtime, Combinator::All, false);
+}
+
+CallResult<HermesValue> promiseAllSettledResolveElement(
+    void *,
+    Runtime &runtime) {
+  return elementFunction(runtime, Combinator::AllSettled, false);
+}
+
+CallResult<HermesValue> promiseAllSettledRejectElement(
+    void *,
+    Runtime &runtime) {
+  return elementFunction(runtime, Combinator::AllSettled, true);
+}
+
+CallResult<HermesValue> promiseAnyRejectElement(void *, Runtime &runtime) {
+  return elementFunction(runtime, Combinator::Any, true);
+}
+
+} // namespace vm
+} // namespace hermes
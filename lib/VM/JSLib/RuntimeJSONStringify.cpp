@@ -10,6 +10,9 @@
 #include "Object.h"
 
 #include "hermes/Support/BuildTable256.h"
+#include "hermes/Support/Conversions.h"
+#include "hermes/Support/FastCharScan.h"
+#include "hermes/Support/UTF8.h"
 #include "hermes/VM/ArrayLike.h"
 #include "hermes/VM/ArrayStorage.h"
 #include "hermes/VM/Callable.h"
@@ -24,6 +27,104 @@ namespace vm {
 
 namespace {
 
+/// The output of JSON.stringify. It is kept in a one-byte buffer for as long as
+/// everything written to it is ASCII, which is the common case, and widened to
+/// UTF-16 when the first other character is written. The result string takes
+/// over the buffer when it is large enough to be external, and is otherwise
+/// copied from it without scanning or narrowing it again.
+class JSONOutput {
+  /// The output while it is all ASCII.
+  std::string ascii_{};
+
+  /// The output once it has been widened.
+  std::u16string utf16_{};
+
+  /// Whether the output has been widened into utf16_.
+  bool isUTF16_{false};
+
+  /// Move the output written so far into utf16_.
+  void widen() {
+    utf16_.assign(ascii_.begin(), ascii_.end());
+    ascii_ = std::string{};
+    isUTF16_ = true;
+  }
+
+ public:
+  size_t size() const {
+    return isUTF16_ ? utf16_.size() : ascii_.size();
+  }
+
+  /// Truncate the output to \p size characters.
+  void resize(size_t size) {
+    assert(size <= this->size() && "output can only be truncated");
+    if (isUTF16_)
+      utf16_.resize(size);
+    else
+      ascii_.resize(size);
+  }
+
+  void clear() {
+    ascii_.clear();
+    utf16_.clear();
+    isUTF16_ = false;
+  }
+
+  void push_back(char16_t ch) {
+    if (LLVM_LIKELY(!isUTF16_)) {
+      if (LLVM_LIKELY(ch < 0x80)) {
+        ascii_.push_back(static_cast<char>(ch));
+        return;
+      }
+      widen();
+    }
+    utf16_.push_back(ch);
+  }
+
+  void append(std::initializer_list<char16_t> chars) {
+    for (char16_t ch : chars)
+      push_back(ch);
+  }
+
+  /// Append the ASCII characters in [begin, end).
+  void append(const char *begin, const char *end) {
+    if (LLVM_LIKELY(!isUTF16_))
+      ascii_.append(begin, end);
+    else
+      utf16_.append(begin, end);
+  }
+
+  /// Append the characters in [begin, end).
+  void append(const char16_t *begin, const char16_t *end) {
+    if (!isUTF16_) {
+      if (isAllASCII(begin, end)) {
+        ascii_.append(begin, end);
+        return;
+      }
+      widen();
+    }
+    utf16_.append(begin, end);
+  }
+
+  /// Append the characters of \p str.
+  void append(const StringPrimitive *str) {
+    if (str->isASCII()) {
+      ASCIIRef ref = str->getStringRef<char>();
+      append(ref.begin(), ref.end());
+    } else {
+      UTF16Ref ref = str->getStringRef<char16_t>();
+      append(ref.begin(), ref.end());
+    }
+  }
+
+  /// Create a string with the output, leaving the output in an unspecified
+  /// state.
+  CallResult<HermesValue> toString(Runtime &runtime) {
+    if (isUTF16_)
+      return StringPrimitive::createEfficient(runtime, std::move(utf16_));
+    return StringPrimitive::createEfficient(runtime, std::move(ascii_));
+  }
+};
+
 /// This class wraps the functionality required to stringify an object
 /// as JSON.
 class JSONStringifyer {
@@ -84,7 +185,7 @@ class JSONStringifyer {
       ;
 
   /// The output buffer. The serialization process will append into it.
-  llvh::SmallVector<char16_t, 32> output_{};
+  JSONOutput output_{};
 
  public:
   explicit JSONStringifyer(Runtime &runtime)
@@ -153,6 +254,13 @@ class JSONStringifyer {
   /// It serializes an object.
   ExecutionStatus operationJO();
 
+  /// \return the enumerable string keys of objects of class \p clazz, in an
+  /// ArrayStorageSmall holding for each key the key string, the quoted
+  /// "key": fragment and the slot index of the property. The result is cached
+  /// on the class unless it is a dictionary.
+  /// \pre \p clazz has no accessors and no index-like properties.
+  CallResult<HermesValue> getKeyFragments(Handle<HiddenClass> clazz);
+
   /// Templated helper for operationJO that processes properties. UseFastPath
   /// indicates that the given object is 'simple', and we can iterate its
   /// properties directly, which were collected in \p operationJOKFast.
@@ -160,9 +268,8 @@ class JSONStringifyer {
   /// \param objHandle Object handle for the object being stringified.
   /// \param operationJOK Property keys for the slow path (propertyList,
   ///   accessors, proxies). Only used when UseFastPath is false.
-  /// \param operationJOKFast Property keys for the fast path (simple objects).
-  /// \param operationJOKFastIndices 1:1 mapping from each element in
-  ///   operationJOKFast to its slot index.
+  /// \param operationJOKFast Property keys, key fragments and slot indices for
+  ///   the fast path (simple objects), as returned by getKeyFragments.
   /// \param originalClazz The original HiddenClass, used to detect if the
   ///   object's shape changed. Only used when UseFastPath is true.
   /// \param stepBack The depth count to restore after processing.
@@ -172,7 +279,6 @@ class JSONStringifyer {
       Handle<JSObject> objHandle,
       Handle<JSArray> operationJOK,
       Handle<ArrayStorageSmall> operationJOKFast,
-      llvh::ArrayRef<SlotIndex> operationJOKFastIndices,
       Handle<HiddenClass> originalClazz,
       uint32_t stepBack,
       size_t beginningLoc);
@@ -491,12 +597,12 @@ CallResult<bool> JSONStringifyer::operationStrValue(
 
   // Str.9.
   if (lv_.operationStrValue->isNumber()) {
-    if (std::isfinite(lv_.operationStrValue->getNumber())) {
-      auto status = toString_RJS(runtime_, lv_.operationStrValue);
-      assert(
-          status != ExecutionStatus::EXCEPTION &&
-          "toString on a number cannot fail");
-      appendToOutput(status->get());
+    double num = lv_.operationStrValue->getNumber();
+    if (std::isfinite(num)) {
+      // Write the number directly instead of creating a string for it.
+      char buf8[NUMBER_TO_STRING_BUF_SIZE];
+      size_t len = numberToString(num, buf8, sizeof(buf8));
+      output_.append(buf8, buf8 + len);
     } else {
       appendToOutput(Predefined::getSymbolID(Predefined::null));
     }
@@ -619,6 +725,12 @@ void quoteStringForJSON(Output &output, llvh::ArrayRef<CharT> view) {
   const CharT *beginUnescPtr = begin;
   // Quote.2.
   while (cursor < end) {
+    if constexpr (sizeof(CharT) == 1) {
+      // Skip the run of characters that need no escaping.
+      cursor = scanUntilJSONEscape(cursor, end);
+      if (cursor == end)
+        break;
+    }
     CharT ch = *cursor;
     if constexpr (sizeof(CharT) > 1) {
       if (ch >= UNICODE_SURROGATE_FIRST && ch <= UNICODE_SURROGATE_LAST) {
@@ -691,6 +803,79 @@ void JSONStringifyer::operationQuote(StringView value) {
   }
 }
 
+CallResult<HermesValue> JSONStringifyer::getKeyFragments(
+    Handle<HiddenClass> clazz) {
+  if (ArrayStorageSmall *cached = clazz->getJSONStringifyCache(runtime_))
+    return HermesValue::encodeObjectValue(cached);
+
+  struct : public Locals {
+    PinnedValue<ArrayStorageSmall> keys;
+    PinnedValue<> fragment;
+  } lv;
+  LocalsRAII lraii(runtime_, &lv);
+  GCScopeMarkerRAII marker{runtime_};
+
+  // Collect the properties first, since creating the fragments allocates.
+  llvh::SmallVector<std::pair<SymbolID, SlotIndex>, 8> props;
+  HiddenClass::forEachProperty(
+      clazz, runtime_, [&props](SymbolID id, NamedPropertyDescriptor desc) {
+        if (!desc.flags.enumerable)
+          return;
+        if (desc.flags.privateName)
+          return;
+        if (!isPropertyNamePrimitive(id))
+          return;
+        props.push_back({id, desc.slot});
+      });
+
+  // A dictionary is modified in place, so its keys can't be cached.
+  const bool cache = !clazz->isDictionary();
+  auto size = static_cast<ArrayStorageSmall::size_type>(props.size() * 3);
+  auto arrRes = cache ? ArrayStorageSmall::createLongLived(runtime_, size)
+                      : ArrayStorageSmall::create(runtime_, size);
+  if (LLVM_UNLIKELY(arrRes == ExecutionStatus::EXCEPTION)) {
+    return ExecutionStatus::EXCEPTION;
+  }
+  lv.keys = vmcast<ArrayStorageSmall>(*arrRes);
+  ArrayStorageSmall::resizeWithinCapacity(lv.keys.get(), runtime_, size);
+
+  JSONOutput fragment;
+  for (size_t i = 0, e = props.size(); i < e; ++i) {
+    StringPrimitive *key = runtime_.getStringPrimFromSymbolID(props[i].first);
+    fragment.clear();
+    if (key->isASCII()) {
+      quoteStringForJSON(fragment, key->getStringRef<char>());
+    } else {
+      quoteStringForJSON(fragment, key->getStringRef<char16_t>());
+    }
+    fragment.push_back(u':');
+    auto fragmentRes = fragment.toString(runtime_);
+    if (LLVM_UNLIKELY(fragmentRes == ExecutionStatus::EXCEPTION)) {
+      return ExecutionStatus::EXCEPTION;
+    }
+    lv.fragment = *fragmentRes;
+
+    auto &heap = runtime_.getHeap();
+    key = runtime_.getStringPrimFromSymbolID(props[i].first);
+    lv.keys->set(
+        i * 3, SmallHermesValue::encodeStringValue(key, runtime_), heap);
+    lv.keys->set(
+        i * 3 + 1,
+        SmallHermesValue::encodeStringValue(
+            vmcast<StringPrimitive>(*lv.fragment), runtime_),
+        heap);
+    lv.keys->set(
+        i * 3 + 2,
+        SmallHermesValue::encodeNumberValue(props[i].second, runtime_),
+        heap);
+    marker.flush();
+  }
+
+  if (cache)
+    clazz->setJSONStringifyCache(lv.keys.get(), runtime_);
+  return lv.keys.getHermesValue();
+}
+
 ExecutionStatus JSONStringifyer::operationJA() {
   struct : public Locals {
     PinnedValue<JSObject> arrayObject;
@@ -811,13 +996,11 @@ ExecutionStatus JSONStringifyer::operationJO() {
     PinnedValue<JSArray> operationJOK;
     /// Object being stringified.
     PinnedValue<JSObject> objHandle;
-    /// Property keys (fast path).
+    /// Property keys, key fragments and slot indices (fast path).
     PinnedValue<ArrayStorageSmall> operationJOKFast;
     /// Original HiddenClass for detecting shape changes.
     PinnedValue<HiddenClass> originalClazz;
   } lv;
-  /// Slot indices corresponding to operationJOKFast entries.
-  std::vector<SlotIndex> operationJOKFastIndices;
   LocalsRAII lraii(runtime_, &lv);
 
   // JO.3.
@@ -853,40 +1036,15 @@ ExecutionStatus JSONStringifyer::operationJO() {
       if (LLVM_LIKELY(
               !clazz->isDictionaryNoCache() && !clazz->getMayHaveAccessor() &&
               !clazz->getHasIndexLikeProperties() && !hasIndexedElements)) {
-        // Fast path: iterate the HiddenClass directly and collect enumerable
-        // property names and slot indices.
+        // Fast path: use the enumerable property names of the HiddenClass,
+        // their quoted key fragments and their slot indices.
         useFastPath = true;
         lv.originalClazz = clazz;
-        auto numElements = clazz->getNumProperties();
-        auto propRes =
-            ArrayStorageSmall::create(runtime_, numElements, numElements);
-        if (LLVM_UNLIKELY(propRes == ExecutionStatus::EXCEPTION)) {
+        auto keysRes = getKeyFragments(lv.originalClazz);
+        if (LLVM_UNLIKELY(keysRes == ExecutionStatus::EXCEPTION)) {
           return ExecutionStatus::EXCEPTION;
         }
-        lv.operationJOKFast = vmcast<ArrayStorageSmall>(*propRes);
-        operationJOKFastIndices.reserve(numElements);
-        ArrayStorageSmall::size_type i = 0;
-        HiddenClass::forEachProperty(
-            lv.originalClazz,
-            runtime_,
-            [&runtime = runtime_, &lv, &i, &operationJOKFastIndices](
-                SymbolID id, NamedPropertyDescriptor desc) {
-              if (!desc.flags.enumerable)
-                return;
-              if (desc.flags.privateName)
-                return;
-              if (!isPropertyNamePrimitive(id))
-                return;
-              StringPrimitive *prim = runtime.getStringPrimFromSymbolID(id);
-              auto shv = SmallHermesValue::encodeStringValue(prim, runtime);
-              lv.operationJOKFast->set(i, shv, runtime.getHeap());
-              // Store the slot index for direct access later.
-              operationJOKFastIndices.push_back(desc.slot);
-              ++i;
-            });
-        // Resize to actual count since we may have skipped properties.
-        ArrayStorageSmall::resizeWithinCapacity(
-            lv.operationJOKFast.get(), runtime_, i);
+        lv.operationJOKFast = vmcast<ArrayStorageSmall>(*keysRes);
       } else {
         // Slow path: object may have accessors or index-like properties.
         // enumerableOwnProperties_RJS is the spec definition, and is
@@ -916,7 +1074,6 @@ ExecutionStatus JSONStringifyer::operationJO() {
         lv.objHandle,
         lv.operationJOK,
         lv.operationJOKFast,
-        operationJOKFastIndices,
         lv.originalClazz,
         stepBack,
         beginningLoc);
@@ -925,7 +1082,6 @@ ExecutionStatus JSONStringifyer::operationJO() {
         lv.objHandle,
         lv.operationJOK,
         lv.operationJOKFast,
-        operationJOKFastIndices,
         lv.originalClazz,
         stepBack,
         beginningLoc);
@@ -937,7 +1093,6 @@ ExecutionStatus JSONStringifyer::operationJOProcessProperties(
     Handle<JSObject> objHandle,
     Handle<JSArray> operationJOK,
     Handle<ArrayStorageSmall> operationJOKFast,
-    llvh::ArrayRef<SlotIndex> operationJOKFastIndices,
     Handle<HiddenClass> originalClazz,
     uint32_t stepBack,
     size_t beginningLoc) {
@@ -947,7 +1102,7 @@ ExecutionStatus JSONStringifyer::operationJOProcessProperties(
   bool hasElement = false;
   uint32_t len;
   if constexpr (UseFastPath) {
-    len = operationJOKFast->size();
+    len = operationJOKFast->size() / 3;
   } else {
     len = operationJOK->getEndIndex();
   }
@@ -967,29 +1122,33 @@ ExecutionStatus JSONStringifyer::operationJOProcessProperties(
     }
 
     if constexpr (UseFastPath) {
-      lv_.tmpHandle = operationJOKFast->at(index).unboxToHV(runtime_);
+      lv_.tmpHandle = operationJOKFast->at(index * 3).unboxToHV(runtime_);
+      // JO.8.b.i, JO.8.b.ii: the key is already quoted and followed by ':'.
+      appendToOutput(
+          vmcast<StringPrimitive>(
+              operationJOKFast->at(index * 3 + 1).unboxToHV(runtime_)));
     } else {
       lv_.tmpHandle = operationJOK->at(runtime_, index).unboxToHV(runtime_);
+      if (LLVM_UNLIKELY(!lv_.tmpHandle->isString())) {
+        // property may come from getOwnPropertyNames, which may contain
+        // numbers. getOwnPropertyNames and lv_.propertyList are both only
+        // populated with strings, numbers, and undefined only.
+        // None of them are objects, so toString cannot throw.
+        assert(!lv_.tmpHandle->isObject() && "property name is an object");
+        auto status = toString_RJS(runtime_, lv_.tmpHandle);
+        assert(
+            status != ExecutionStatus::EXCEPTION &&
+            "toString on a property cannot fail");
+        lv_.tmpHandle = status->getHermesValue();
+      }
+      // tmpHandle now contains property as string.
+      // JO.8.b.i
+      operationQuote(
+          StringPrimitive::createStringView(
+              runtime_, Handle<StringPrimitive>::vmcast(&lv_.tmpHandle)));
+      // JO.8.b.ii
+      output_.push_back(u':');
     }
-    if (LLVM_UNLIKELY(!lv_.tmpHandle->isString())) {
-      // property may come from getOwnPropertyNames, which may contain
-      // numbers. getOwnPropertyNames and lv_.propertyList are both only
-      // populated with strings, numbers, and undefined only.
-      // None of them are objects, so toString cannot throw.
-      assert(!lv_.tmpHandle->isObject() && "property name is an object");
-      auto status = toString_RJS(runtime_, lv_.tmpHandle);
-      assert(
-          status != ExecutionStatus::EXCEPTION &&
-          "toString on a property cannot fail");
-      lv_.tmpHandle = status->getHermesValue();
-    }
-    // tmpHandle now contains property as string.
-    // JO.8.b.i
-    operationQuote(
-        StringPrimitive::createStringView(
-            runtime_, Handle<StringPrimitive>::vmcast(&lv_.tmpHandle)));
-    // JO.8.b.ii
-    output_.push_back(u':');
     // JO.8.b.iii
     if (lv_.gap.get()) {
       output_.push_back(u' ');
@@ -1000,7 +1159,8 @@ ExecutionStatus JSONStringifyer::operationJOProcessProperties(
             UseFastPath &&
             objHandle->getClass(runtime_) == originalClazz.get())) {
       // Fast path: object's class hasn't changed, use direct slot access.
-      SlotIndex slotIndex = operationJOKFastIndices[index];
+      SlotIndex slotIndex =
+          operationJOKFast->at(index * 3 + 2).getNumber(runtime_);
       auto shv =
           JSObject::getNamedSlotValueUnsafe(*objHandle, runtime_, slotIndex);
       lv_.operationStrValue = shv.unboxToHV(runtime_);
@@ -1079,7 +1239,7 @@ void JSONStringifyer::appendToOutput(SymbolID identifierID) {
 }
 
 void JSONStringifyer::appendToOutput(const StringPrimitive *str) {
-  str->appendUTF16String(output_);
+  output_.append(str);
 }
 
 CallResult<HermesValue> JSONStringifyer::stringify(Handle<> value) {
@@ -1108,7 +1268,7 @@ CallResult<HermesValue> JSONStringifyer::stringify(Handle<> value) {
     return ExecutionStatus::EXCEPTION;
   }
   if (status.getValue()) {
-    return StringPrimitive::create(runtime_, output_);
+    return output_.toString(runtime_);
   } else {
     return HermesValue::encodeUndefinedValue();
   }
@@ -0,0 +1,676 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include "hermes/VM/JSPromise.h"
+
+#include "hermes/VM/BuildMetadata.h"
+#include "hermes/VM/JSNativeFunctions.h"
+#include "hermes/VM/Operations.h"
+#include "hermes/VM/Runtime-inline.h"
+
+namespace hermes {
+namespace vm {
+
+const ObjectVTable JSPromise::vt{
+    VTable(CellKind::JSPromiseKind, cellSize<JSPromise>()),
+    JSPromise::_getOwnIndexedRangeImpl,
+    JSPromise::_haveOwnIndexedImpl,
+    JSPromise::_getOwnIndexedPropertyFlagsImpl,
+    JSPromise::_getOwnIndexedImpl,
+    JSPromise::_setOwnIndexedImpl,
+    JSPromise::_deleteOwnIndexedImpl,
+    JSPromise::_checkAllOwnIndexedImpl,
+};
+
+void JSPromiseBuildMeta(const GCCell *cell, Metadata::Builder &mb) {
+  mb.addJSObjectOverlapSlots(JSObject::numOverlapSlots<JSPromise>());
+  JSObjectBuildMeta(cell, mb);
+  const auto *self = static_cast<const JSPromise *>(cell);
+  mb.setVTable(&JSPromise::vt);
+  mb.addField("result", &self->result_);
+  mb.addField("onFulfilled", &self->onFulfilled_);
+  mb.addField("onRejected", &self->onRejected_);
+  mb.addField("capability", &self->capability_);
+  mb.addField("moreReactions", &self->moreReactions_);
+}
+
+PseudoHandle<JSPromise> JSPromise::create(
+    Runtime &runtime,
+    Handle<JSObject> parentHandle) {
+  auto *cell = runtime.makeAFixed<JSPromise>(
+      runtime,
+      parentHandle,
+      runtime.getHiddenClassForPrototype(
+          *parentHandle, numOverlapSlots<JSPromise>()));
+  return JSObjectInit::initToPseudoHandle(runtime, cell);
+}
+
+void JSPromise::createResolvingFunctions(
+    Runtime &runtime,
+    Handle<JSPromise> self,
+    MutableHandle<NativeFunction> resolve,
+    MutableHandle<NativeFunction> reject) {
+  resolve = NativeFunction::create(
+                runtime,
+                Handle<JSObject>::vmcast(&runtime.functionPrototype),
+                Runtime::makeNullHandle<Environment>(),
+                nullptr,
+                promiseResolveFunction,
+                Predefined::getSymbolID(Predefined::emptyString),
+                1,
+                Runtime::makeNullHandle<JSObject>(),
+                RFCount)
+                .get();
+  reject = NativeFunction::create(
+               runtime,
+               Handle<JSObject>::vmcast(&runtime.functionPrototype),
+               Runtime::makeNullHandle<Environment>(),
+               nullptr,
+               promiseRejectFunction,
+               Predefined::getSymbolID(Predefined::emptyString),
+               1,
+               Runtime::makeNullHandle<JSObject>(),
+               RFCount)
+               .get();
+
+  // Both functions share [[Promise]] and [[AlreadyResolved]]: each of them
+  // holds the promise and the other function, and clears the promise in both
+  // when called.
+  auto promise =
+      SmallHermesValue::encodeObjectValue(self.get(), runtime);
+  NativeFunction::setAdditionalSlotValue(
+      resolve.get(), runtime, RFPromise, promise);
+  NativeFunction::setAdditionalSlotValue(
+      resolve.get(),
+      runtime,
+      RFSibling,
+      SmallHermesValue::encodeObjectValue(reject.get(), runtime));
+  NativeFunction::setAdditionalSlotValue(
+      reject.get(), runtime, RFPromise, promise);
+  NativeFunction::setAdditionalSlotValue(
+      reject.get(),
+      runtime,
+      RFSibling,
+      SmallHermesValue::encodeObjectValue(resolve.get(), runtime));
+}
+
+namespace {
+
+/// Reject \p promise with the value that was just thrown.
+/// \return EXCEPTION if the thrown value is uncatchable, leaving it thrown,
+///   or if rejecting threw.
+ExecutionStatus rejectWithThrownValue(
+    Runtime &runtime,
+    Handle<JSPromise> promise) {
+  if (LLVM_UNLIKELY(isUncatchableError(runtime.getThrownValue())))
+    return ExecutionStatus::EXCEPTION;
+
+  struct : public Locals {
+    PinnedValue<> reason;
+  } lv;
+  LocalsRAII lraii(runtime, &lv);
+  lv.reason = runtime.getThrownValue();
+  runtime.clearThrownValue();
+  return JSPromise::reject(runtime, promise, lv.reason);
+}
+
+} // namespace
+
+ExecutionStatus JSPromise::resolve(
+    Runtime &runtime,
+    Handle<JSPromise> self,
+    Handle<> resolution) {
+  assert(self->state_ == State::Pending && "promise is already settled");
+
+  // 7. If SameValue(resolution, promise) is true, then
+  if (resolution->getRaw() == self.getHermesValue().getRaw()) {
+    // a. Let selfResolutionError be a newly created TypeError object.
+    // b. Perform RejectPromise(promise, selfResolutionError).
+    (void)runtime.raiseTypeError("Promise cannot be resolved with itself");
+    return rejectWithThrownValue(runtime, self);
+  }
+
+  // 8. If resolution is not an Object, then
+  //   a. Perform FulfillPromise(promise, resolution).
+  if (!resolution->isObject()) {
+    settle(runtime, self, State::Fulfilled, resolution);
+    return ExecutionStatus::RETURNED;
+  }
+
+  // 9. Let then be Completion(Get(resolution, "then")).
+  auto thenRes = JSObject::getNamed_RJS(
+      Handle<JSObject>::vmcast(resolution),
+      runtime,
+      Predefined::getSymbolID(Predefined::then));
+  // 10. If then is an abrupt completion, then
+  //   a. Perform RejectPromise(promise, then.[[Value]]).
+  if (LLVM_UNLIKELY(thenRes == ExecutionStatus::EXCEPTION))
+    return rejectWithThrownValue(runtime, self);
+
+  // 12. If IsCallable(thenAction) is false, then
+  //   a. Perform FulfillPromise(promise, resolution).
+  if (!vmisa<Callable>(thenRes->get())) {
+    settle(runtime, self, State::Fulfilled, resolution);
+    return ExecutionStatus::RETURNED;
+  }
+
+  // 14. Let job be NewPromiseResolveThenableJob(promise, resolution,
+  //     thenJobCallback).
+  // 15. Perform HostEnqueuePromiseJob(job.[[Job]], job.[[Realm]]).
+  runtime.enqueuePromiseJob(
+      Runtime::Job::Kind::PromiseResolveThenable,
+      thenRes->get(),
+      *resolution,
+      self.getHermesValue());
+  return ExecutionStatus::RETURNED;
+}
+
+ExecutionStatus
+JSPromise::reject(Runtime &runtime, Handle<JSPromise> self, Handle<> reason) {
+  assert(self->state_ == State::Pending && "promise is already settled");
+  settle(runtime, self, State::Rejected, reason);
+  // 7. If promise.[[PromiseIsHandled]] is false, perform
+  //    HostPromiseRejectionTracker(promise, "reject").
+  if (!self->isHandled_)
+    return trackRejection(runtime, self, false);
+  return ExecutionStatus::RETURNED;
+}
+
+void JSPromise::settle(
+    Runtime &runtime,
+    Handle<JSPromise> self,
+    State state,
+    Handle<> result) {
+  assert(state != State::Pending && "cannot settle to the pending state");
+  GC &heap = runtime.getHeap();
+  self->result_.set(*result, heap);
+  self->state_ = state;
+
+  // Trigger the reactions in the order in which they were registered. None of
+  // this allocates, so the raw pointers are safe.
+  if (self->hasReaction_) {
+    enqueueReaction(
+        runtime,
+        state,
+        *result,
+        self->onFulfilled_,
+        self->onRejected_,
+        self->capability_);
+    self->onFulfilled_.setNonPtr(HermesValue::encodeUndefinedValue(), heap);
+    self->onRejected_.setNonPtr(HermesValue::encodeUndefinedValue(), heap);
+    self->capability_.setNonPtr(HermesValue::encodeUndefinedValue(), heap);
+    self->hasReaction_ = false;
+  }
+  if (ArrayStorage *more = self->moreReactions_.get(runtime)) {
+    for (ArrayStorage::size_type i = 0, e = more->size(); i < e; i += 3) {
+      enqueueReaction(
+          runtime,
+          state,
+          *result,
+          more->at(i),
+          more->at(i + 1),
+          more->at(i + 2));
+    }
+    self->moreReactions_.setNull(heap);
+  }
+}
+
+ExecutionStatus JSPromise::trackRejection(
+    Runtime &runtime,
+    Handle<JSPromise> self,
+    bool isHandle) {
+  if (LLVM_LIKELY(!vmisa<Callable>(*runtime.promiseRejectionTracker_)))
+    return ExecutionStatus::RETURNED;
+  return Callable::executeCall3(
+             Handle<Callable>::vmcast(&runtime.promiseRejectionTracker_),
+             runtime,
+             Runtime::getUndefinedValue(),
+             self.getHermesValue(),
+             self->result_,
+             HermesValue::encodeBoolValue(isHandle))
+      .getStatus();
+}
+
+void JSPromise::enqueueReaction(
+    Runtime &runtime,
+    State state,
+    HermesValue result,
+    HermesValue onFulfilled,
+    HermesValue onRejected,
+    HermesValue capability) {
+  if (state == State::Fulfilled) {
+    runtime.enqueuePromiseJob(
+        Runtime::Job::Kind::PromiseFulfill, onFulfilled, result, capability);
+  } else {
+    runtime.enqueuePromiseJob(
+        Runtime::Job::Kind::PromiseReject, onRejected, result, capability);
+  }
+}
+
+ExecutionStatus JSPromise::performThen(
+    Runtime &runtime,
+    Handle<JSPromise> self,
+    Handle<> onFulfilled,
+    Handle<> onRejected,
+    Handle<> capability) {
+  // 3. If IsCallable(onFulfilled) is false, then
+  //   a. Set onFulfilled to undefined.
+  if (!vmisa<Callable>(*onFulfilled))
+    onFulfilled = Runtime::getUndefinedValue();
+  // 4. If IsCallable(onRejected) is false, then
+  //   a. Set onRejected to undefined.
+  if (!vmisa<Callable>(*onRejected))
+    onRejected = Runtime::getUndefinedValue();
+
+  switch (self->state_) {
+    // 9. If promise.[[PromiseState]] is pending, then
+    //   a. Append fulfillReaction to promise.[[PromiseFulfillReactions]].
+    //   b. Append rejectReaction to promise.[[PromiseRejectReactions]].
+    case State::Pending:
+      if (!self->hasReaction_) {
+        GC &heap = runtime.getHeap();
+        self->onFulfilled_.set(*onFulfilled, heap);
+        self->onRejected_.set(*onRejected, heap);
+        self->capability_.set(*capability, heap);
+        self->hasReaction_ = true;
+      } else {
+        struct : public Locals {
+          PinnedValue<ArrayStorage> reactions;
+        } lv;
+        LocalsRAII lraii(runtime, &lv);
+        if (ArrayStorage *more = self->moreReactions_.get(runtime)) {
+          lv.reactions = more;
+        } else {
+          auto arrRes = ArrayStorage::create(runtime, 3);
+          if (LLVM_UNLIKELY(arrRes == ExecutionStatus::EXCEPTION))
+            return ExecutionStatus::EXCEPTION;
+          lv.reactions.castAndSetHermesValue<ArrayStorage>(*arrRes);
+        }
+        MutableHandle<ArrayStorage> reactions{lv.reactions};
+        if (LLVM_UNLIKELY(
+                ArrayStorage::push_back(reactions, runtime, onFulfilled) ==
+                    ExecutionStatus::EXCEPTION ||
+                ArrayStorage::push_back(reactions, runtime, onRejected) ==
+                    ExecutionStatus::EXCEPTION ||
+                ArrayStorage::push_back(reactions, runtime, capability) ==
+                    ExecutionStatus::EXCEPTION)) {
+          return ExecutionStatus::EXCEPTION;
+        }
+        self->moreReactions_.set(runtime, *reactions, runtime.getHeap());
+      }
+      break;
+
+    // 10. Else if promise.[[PromiseState]] is fulfilled, then
+    //   b. Let fulfillJob be NewPromiseReactionJob(fulfillReaction, value).
+    //   c. Perform HostEnqueuePromiseJob(fulfillJob.[[Job]], ...).
+    case State::Fulfilled:
+      enqueueReaction(
+          runtime,
+          State::Fulfilled,
+          self->result_,
+          *onFulfilled,
+          *onRejected,
+          *capability);
+      break;
+
+    // 11. Else,
+    //   c. If promise.[[PromiseIsHandled]] is false, perform
+    //      HostPromiseRejectionTracker(promise, "handle").
+    //   d. Let rejectJob be NewPromiseReactionJob(rejectReaction, reason).
+    //   e. Perform HostEnqueuePromiseJob(rejectJob.[[Job]], ...).
+    case State::Rejected:
+      enqueueReaction(
+          runtime,
+          State::Rejected,
+          self->result_,
+          *onFulfilled,
+          *onRejected,
+          *capability);
+      if (!self->isHandled_) {
+        self->isHandled_ = true;
+        return trackRejection(runtime, self, true);
+      }
+      break;
+  }
+
+  // 12. Set promise.[[PromiseIsHandled]] to true.
+  self->isHandled_ = true;
+  return ExecutionStatus::RETURNED;
+}
+
+CallResult<HermesValue> JSPromise::newPromiseCapability(
+    Runtime &runtime,
+    Handle<> C,
+    bool needFunctions) {
+  struct : public Locals {
+    PinnedValue<JSPromise> intrinsicPromise;
+    PinnedValue<NativeFunction> resolvingResolve;
+    PinnedValue<NativeFunction> resolvingReject;
+    PinnedValue<NativeFunction> executor;
+    PinnedValue<> promise;
+    PinnedValue<> resolve;
+    PinnedValue<> reject;
+  } lv;
+  LocalsRAII lraii(runtime, &lv);
+
+  if (LLVM_LIKELY(
+          C->getRaw() == runtime.promiseConstructor.getHermesValue().getRaw())) {
+    // Constructing the intrinsic %Promise% has no observable side effect, so
+    // create the promise directly. Its resolving functions are only needed if
+    // the caller hands them out.
+    lv.intrinsicPromise = JSPromise::create(
+        runtime, Handle<JSObject>::vmcast(&runtime.promisePrototype));
+    if (!needFunctions)
+      return lv.intrinsicPromise.getHermesValue();
+    createResolvingFunctions(
+        runtime,
+        lv.intrinsicPromise,
+        lv.resolvingResolve,
+        lv.resolvingReject);
+    lv.promise = lv.intrinsicPromise.getHermesValue();
+    lv.resolve = lv.resolvingResolve.getHermesValue();
+    lv.reject = lv.resolvingReject.getHermesValue();
+  } else {
+    // 1. If IsConstructor(C) is false, throw a TypeError exception.
+    if (!isConstructor(runtime, *C)) {
+      return runtime.raiseTypeError(
+          "Promise capability constructor is not a constructor");
+    }
+    // 3. Let resolvingFunctions be the Record { [[Resolve]]: undefined,
+    //    [[Reject]]: undefined }.
+    // 4. Let executorClosure be a new Abstract Closure ...
+    // 5. Let executor be CreateBuiltinFunction(executorClosure, 2, "", « »).
+    lv.executor = NativeFunction::create(
+        runtime,
+        Handle<JSObject>::vmcast(&runtime.functionPrototype),
+        Runtime::makeNullHandle<Environment>(),
+        nullptr,
+        promiseCapabilityExecutor,
+        Predefined::getSymbolID(Predefined::emptyString),
+        2,
+        Runtime::makeNullHandle<JSObject>(),
+        ExecutorSlotCount);
+    NativeFunction::setAdditionalSlotValue(
+        *lv.executor,
+        runtime,
+        ExecutorResolve,
+        SmallHermesValue::encodeUndefinedValue());
+    NativeFunction::setAdditionalSlotValue(
+        *lv.executor,
+        runtime,
+        ExecutorReject,
+        SmallHermesValue::encodeUndefinedValue());
+
+    // 6. Let promise be ? Construct(C, « executor »).
+    auto promiseRes = Callable::executeConstruct1(
+        Handle<Callable>::vmcast(C), runtime, lv.executor);
+    if (LLVM_UNLIKELY(promiseRes == ExecutionStatus::EXCEPTION))
+      return ExecutionStatus::EXCEPTION;
+    lv.promise = std::move(*promiseRes);
+
+    // 7. If IsCallable(resolvingFunctions.[[Resolve]]) is false, throw a
+    //    TypeError exception.
+    lv.resolve = NativeFunction::getAdditionalSlotValue(
+                     *lv.executor, runtime, ExecutorResolve)
+                     .unboxToHV(runtime);
+    if (!vmisa<Callable>(*lv.resolve)) {
+      return runtime.raiseTypeError(
+          "Promise capability resolve function is not callable");
+    }
+    // 8. If IsCallable(resolvingFunctions.[[Reject]]) is false, throw a
+    //    TypeError exception.
+    lv.reject = NativeFunction::getAdditionalSlotValue(
+                    *lv.executor, runtime, ExecutorReject)
+                    .unboxToHV(runtime);
+    if (!vmisa<Callable>(*lv.reject)) {
+      return runtime.raiseTypeError(
+          "Promise capability reject function is not callable");
+    }
+  }
+
+  // 9. Return the PromiseCapability Record { [[Promise]]: promise,
+  //    [[Resolve]]: resolvingFunctions.[[Resolve]], [[Reject]]:
+  //    resolvingFunctions.[[Reject]] }.
+  auto arrRes = ArrayStorage::create(runtime, CapCount);
+  if (LLVM_UNLIKELY(arrRes == ExecutionStatus::EXCEPTION))
+    return ExecutionStatus::EXCEPTION;
+  auto *capability = vmcast<ArrayStorage>(*arrRes);
+  GC &heap = runtime.getHeap();
+  ArrayStorage::resizeWithinCapacity(capability, heap, CapCount);
+  capability->set(CapPromise, *lv.promise, heap);
+  capability->set(CapResolve, *lv.resolve, heap);
+  capability->set(CapReject, *lv.reject, heap);
+  return HermesValue::encodeObjectValue(capability);
+}
+
+HermesValue JSPromise::capabilityPromise(HermesValue capability) {
+  if (vmisa<JSPromise>(capability))
+    return capability;
+  return vmcast<ArrayStorage>(capability)->at(CapPromise);
+}
+
+ExecutionStatus JSPromise::settleCapability(
+    Runtime &runtime,
+    Handle<> capability,
+    Handle<> value,
+    bool isReject) {
+  if (auto promise = Handle<JSPromise>::dyn_vmcast(capability)) {
+    return isReject ? reject(runtime, promise, value)
+                    : resolve(runtime, promise, value);
+  }
+
+  struct : public Locals {
+    PinnedValue<Callable> fn;
+  } lv;
+  LocalsRAII lraii(runtime, &lv);
+  lv.fn.castAndSetHermesValue<Callable>(
+      vmcast<ArrayStorage>(*capability)->at(isReject ? CapReject : CapResolve));
+  return Callable::executeCall1(
+             lv.fn, runtime, Runtime::getUndefinedValue(), *value)
+      .getStatus();
+}
+
+ExecutionStatus JSPromise::rejectCapabilityWithThrownValue(
+    Runtime &runtime,
+    Handle<> capability) {
+  if (LLVM_UNLIKELY(isUncatchableError(runtime.getThrownValue())))
+    return ExecutionStatus::EXCEPTION;
+
+  struct : public Locals {
+    PinnedValue<> reason;
+  } lv;
+  LocalsRAII lraii(runtime, &lv);
+  lv.reason = runtime.getThrownValue();
+  runtime.clearThrownValue();
+  return settleCapability(runtime, capability, lv.reason, true);
+}
+
+CallResult<HermesValue> JSPromise::speciesConstructor(
+    Runtime &runtime,
+    Handle<JSObject> promise) {
+  // 1. Let C be ? Get(O, "constructor").
+  auto consRes = JSObject::getNamed_RJS(
+      promise, runtime, Predefined::getSymbolID(Predefined::constructor));
+  if (LLVM_UNLIKELY(consRes == ExecutionStatus::EXCEPTION))
+    return ExecutionStatus::EXCEPTION;
+  HermesValue cons = consRes->get();
+  // 2. If C is undefined, return defaultConstructor.
+  if (cons.isUndefined())
+    return runtime.promiseConstructor.getHermesValue();
+  // 3. If C is not an Object, throw a TypeError exception.
+  if (!cons.isObject()) {
+    return runtime.raiseTypeError(
+        "Constructor must be an object if it is not undefined");
+  }
+  // 4-7. Promise[@@species] returns this, so a constructor that inherits it
+  // is its own species.
+  if (isConstructor(runtime, cons))
+    return cons;
+  return runtime.promiseConstructor.getHermesValue();
+}
+
+CallResult<HermesValue>
+JSPromise::promiseResolve(Runtime &runtime, Handle<> C, Handle<> x) {
+  // 1. If IsPromise(x) is true, then
+  if (vmisa<JSPromise>(*x)) {
+    // a. Let xConstructor be ? Get(x, "constructor").
+    auto consRes = JSObject::getNamed_RJS(
+        Handle<JSObject>::vmcast(x),
+        runtime,
+        Predefined::getSymbolID(Predefined::constructor));
+    if (LLVM_UNLIKELY(consRes == ExecutionStatus::EXCEPTION))
+      return ExecutionStatus::EXCEPTION;
+    // b. If SameValue(xConstructor, C) is true, return x.
+    if (isSameValue(consRes->get(), *C))
+      return *x;
+  }
+
+  struct : public Locals {
+    PinnedValue<> capability;
+  } lv;
+  LocalsRAII lraii(runtime, &lv);
+
+  // 2. Let promiseCapability be ? NewPromiseCapability(C).
+  auto capRes = newPromiseCapability(runtime, C);
+  if (LLVM_UNLIKELY(capRes == ExecutionStatus::EXCEPTION))
+    return ExecutionStatus::EXCEPTION;
+  lv.capability = *capRes;
+  // 3. Perform ? Call(promiseCapability.[[Resolve]], undefined, « x »).
+  if (LLVM_UNLIKELY(
+          settleCapability(runtime, lv.capability, x, false) ==
+          ExecutionStatus::EXCEPTION))
+    return ExecutionStatus::EXCEPTION;
+  // 4. Return promiseCapability.[[Promise]].
+  return capabilityPromise(*lv.capability);
+}
+
+ExecutionStatus JSPromise::runJob(
+    Runtime &runtime,
+    Runtime::Job::Kind kind,
+    Handle<> callee,
+    Handle<> argument,
+    Handle<> target) {
+  struct : public Locals {
+    PinnedValue<> result;
+    PinnedValue<NativeFunction> resolve;
+    PinnedValue<NativeFunction> reject;
+    PinnedValue<> capability;
+  } lv;
+  LocalsRAII lraii(runtime, &lv);
+
+  if (kind != Runtime::Job::Kind::PromiseResolveThenable) {
+    // ES2024 27.2.2.1 NewPromiseReactionJob(reaction, argument).
+    bool isAbrupt;
+    if (callee->isUndefined()) {
+      // e. If handler is empty, then
+      //   i. If type is fulfill, let handlerResult be
+      //      NormalCompletion(argument).
+      //   ii. Else, let handlerResult be ThrowCompletion(argument).
+      lv.result = *argument;
+      isAbrupt = kind == Runtime::Job::Kind::PromiseReject;
+    } else {
+      // f. Else, let handlerResult be Completion(HostCallJobCallback(handler,
+      //    undefined, « argument »)).
+      auto callRes = Callable::executeCall1(
+          Handle<Callable>::vmcast(callee),
+          runtime,
+          Runtime::getUndefinedValue(),
+          *argument);
+      if (LLVM_UNLIKELY(callRes == ExecutionStatus::EXCEPTION)) {
+        if (isUncatchableError(runtime.getThrownValue()))
+          return ExecutionStatus::EXCEPTION;
+        lv.result = runtime.getThrownValue();
+        runtime.clearThrownValue();
+        isAbrupt = true;
+      } else {
+        lv.result = std::move(*callRes);
+        isAbrupt = false;
+      }
+    }
+    // g. If promiseCapability is undefined, then
+    //   ii. Return empty.
+    if (target->isUndefined())
+      return ExecutionStatus::RETURNED;
+    // h-i. Call the [[Reject]] or [[Resolve]] function of promiseCapability
+    //      with handlerResult.[[Value]].
+    return settleCapability(runtime, target, lv.result, isAbrupt);
+  }
+
+  // ES2024 27.2.2.2 NewPromiseResolveThenableJob(promiseToResolve, thenable,
+  // then).
+  auto promiseToResolve = Handle<JSPromise>::vmcast(target);
+
+  // Fast path: the thenable is a native promise using the intrinsic "then".
+  // That "then" would create a derived promise which the resolving functions
+  // of promiseToResolve only forward to, so register promiseToResolve as the
+  // derived promise instead. Only the species lookup is observable.
+  auto *thenFn = dyn_vmcast<NativeFunction>(*callee);
+  if (vmisa<JSPromise>(*argument) && thenFn &&
+      thenFn->getFunctionPtr() == promisePrototypeThen) {
+    auto thenable = Handle<JSPromise>::vmcast(argument);
+    auto consRes = speciesConstructor(runtime, thenable);
+    if (LLVM_UNLIKELY(consRes == ExecutionStatus::EXCEPTION))
+      return rejectWithThrownValue(runtime, promiseToResolve);
+    if (LLVM_LIKELY(
+            consRes->getRaw() ==
+            runtime.promiseConstructor.getHermesValue().getRaw())) {
+      return performThen(
+          runtime,
+          thenable,
+          Runtime::getUndefinedValue(),
+          Runtime::getUndefinedValue(),
+          promiseToResolve);
+    }
+
+    // A subclass: perform the rest of Promise.prototype.then with the
+    // constructor that was already read.
+    lv.result = *consRes;
+    createResolvingFunctions(runtime, promiseToResolve, lv.resolve, lv.reject);
+    auto capRes = newPromiseCapability(runtime, lv.result);
+    if (LLVM_UNLIKELY(capRes == ExecutionStatus::EXCEPTION)) {
+      if (isUncatchableError(runtime.getThrownValue()))
+        return ExecutionStatus::EXCEPTION;
+      lv.result = runtime.getThrownValue();
+      runtime.clearThrownValue();
+      return Callable::executeCall1(
+                 lv.reject,
+                 runtime,
+                 Runtime::getUndefinedValue(),
+                 *lv.result)
+          .getStatus();
+    }
+    lv.capability = *capRes;
+    return performThen(runtime, thenable, lv.resolve, lv.reject, lv.capability);
+  }
+
+  // 1. Let resolvingFunctions be CreateResolvingFunctions(promiseToResolve).
+  createResolvingFunctions(runtime, promiseToResolve, lv.resolve, lv.reject);
+  // 2. Let thenCallResult be Completion(HostCallJobCallback(then, thenable,
+  //    « resolvingFunctions.[[Resolve]], resolvingFunctions.[[Reject]] »)).
+  auto callRes = Callable::executeCall2(
+      Handle<Callable>::vmcast(callee),
+      runtime,
+      argument,
+      lv.resolve.getHermesValue(),
+      lv.reject.getHermesValue());
+  // 3. If thenCallResult is an abrupt completion, then
+  //   a. Return ? Call(resolvingFunctions.[[Reject]], undefined,
+  //      « thenCallResult.[[Value]] »).
+  if (LLVM_UNLIKELY(callRes == ExecutionStatus::EXCEPTION)) {
+    if (isUncatchableError(runtime.getThrownValue()))
+      return ExecutionStatus::EXCEPTION;
+    lv.result = runtime.getThrownValue();
+    runtime.clearThrownValue();
+    return Callable::executeCall1(
+               lv.reject, runtime, Runtime::getUndefinedValue(), *lv.result)
+        .getStatus();
+  }
+  return ExecutionStatus::RETURNED;
+}
+
+} // namespace vm
+} // namespace hermes
@@ -171,6 +171,24 @@ ExecutionStatus JSRegExp::initialize(
   llvh::SmallVector<char16_t, 16> patternText16;
   pattern->appendUTF16String(patternText16);
 
+  // Reuse the bytecode if the same pattern and flags were compiled before.
+  RegExpCache &cache = runtime.getRegExpCache();
+  auto sflags = regex::SyntaxFlags::fromString(flagsText16);
+  RegExpCache::Entry *entry =
+      sflags ? cache.find(patternText16, sflags->toByte()) : nullptr;
+  if (entry) {
+    if (LLVM_UNLIKELY(
+            initializeGroupNameMappingObj(
+                runtime,
+                selfHandle,
+                entry->orderedGroupNames,
+                entry->groupNamesMapping) == ExecutionStatus::EXCEPTION)) {
+      return ExecutionStatus::EXCEPTION;
+    }
+    initialize(selfHandle, runtime, pattern, flags, entry->bytecode);
+    return ExecutionStatus::RETURNED;
+  }
+
   // Build the regex.
   regex::Regex<regex::UTF16RegexTraits> regex(patternText16, flagsText16);
 
@@ -191,6 +209,12 @@ ExecutionStatus JSRegExp::initialize(
     return ExecutionStatus::EXCEPTION;
   }
   initialize(selfHandle, runtime, pattern, flags, bytecode);
+  cache.insert(
+      patternText16,
+      sflags->toByte(),
+      std::move(bytecode),
+      std::move(regex.getOrderedNamedGroups()),
+      std::move(regex.getGroupNamesMapping()));
   return ExecutionStatus::RETURNED;
 }
 
@@ -1578,6 +1578,67 @@ CallResult<UncheckedIteratorRecord> getIterator(
           runtime.makeHandle(std::move(*nextMethodRes)))};
 }
 
+CallResult<UncheckedIteratorRecord> getIteratorDirect(
+    Runtime &runtime,
+    Handle<JSObject> obj) {
+  // 1. Let nextMethod be ? Get(obj, "next").
+  CallResult<PseudoHandle<>> nextMethodRes = JSObject::getNamed_RJS(
+      obj, runtime, Predefined::getSymbolID(Predefined::next));
+  if (LLVM_UNLIKELY(nextMethodRes == ExecutionStatus::EXCEPTION)) {
+    return ExecutionStatus::EXCEPTION;
+  }
+  // 2. Let iteratorRecord be the Iterator Record { [[Iterator]]: obj,
+  //    [[NextMethod]]: nextMethod, [[Done]]: false }.
+  return UncheckedIteratorRecord{
+      obj,
+      Handle<HermesValue>::vmcast(
+          runtime.makeHandle(std::move(*nextMethodRes)))};
+}
+
+CallResult<UncheckedIteratorRecord> getIteratorFlattenable(
+    Runtime &runtime,
+    Handle<> obj,
+    PrimitiveHandling primitiveHandling) {
+  // 1. If obj is not an Object, then
+  if (!obj->isObject()) {
+    // a. If primitiveHandling is reject-primitives, throw a TypeError
+    //    exception.
+    // b. Assert: primitiveHandling is iterate-string-primitives.
+    // c. If obj is not a String, throw a TypeError exception.
+    if (primitiveHandling == PrimitiveHandling::RejectPrimitives ||
+        !obj->isString()) {
+      return runtime.raiseTypeError("value is not an object");
+    }
+  }
+  // 2. Let method be ? GetMethod(obj, %Symbol.iterator%).
+  auto methodRes = getMethod(
+      runtime,
+      obj,
+      runtime.makeHandle(Predefined::getSymbolID(Predefined::SymbolIterator)));
+  if (LLVM_UNLIKELY(methodRes == ExecutionStatus::EXCEPTION)) {
+    return ExecutionStatus::EXCEPTION;
+  }
+  // 3. If method is undefined, then
+  //   a. Let iterator be obj.
+  // 4. Else,
+  //   a. Let iterator be ? Call(method, obj).
+  MutableHandle<> iterator{runtime, obj.getHermesValue()};
+  if (!methodRes->getHermesValue().isUndefined()) {
+    auto method = runtime.makeHandle<Callable>(std::move(*methodRes));
+    auto iteratorRes = Callable::executeCall0(method, runtime, obj);
+    if (LLVM_UNLIKELY(iteratorRes == ExecutionStatus::EXCEPTION)) {
+      return ExecutionStatus::EXCEPTION;
+    }
+    iterator = iteratorRes->getHermesValue();
+  }
+  // 5. If iterator is not an Object, throw a TypeError exception.
+  if (LLVM_UNLIKELY(!iterator->isObject())) {
+    return runtime.raiseTypeError("iterator is not an object");
+  }
+  // 6. Return ? GetIteratorDirect(iterator).
+  return getIteratorDirect(runtime, Handle<JSObject>::vmcast(iterator));
+}
+
 CallResult<PseudoHandle<JSObject>> iteratorNext(
     Runtime &runtime,
     const CheckedIteratorRecord &iteratorRecord,
@@ -0,0 +1,74 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include "hermes/VM/RegExpCache.h"
+
+namespace hermes {
+namespace vm {
+
+llvh::ArrayRef<char16_t> RegExpCache::makeKey(
+    llvh::ArrayRef<char16_t> pattern,
+    uint8_t flags) {
+  keyBuf_.clear();
+  keyBuf_.push_back(flags);
+  keyBuf_.append(pattern.begin(), pattern.end());
+  return keyBuf_;
+}
+
+RegExpCache::Entry *RegExpCache::find(
+    llvh::ArrayRef<char16_t> pattern,
+    uint8_t flags) {
+  auto it = map_.find(makeKey(pattern, flags));
+  if (it == map_.end()) {
+    ++numMisses_;
+    return nullptr;
+  }
+  ++numHits_;
+  lru_.use(it->second);
+  return it->second;
+}
+
+void RegExpCache::insert(
+    llvh::ArrayRef<char16_t> pattern,
+    uint8_t flags,
+    std::vector<uint8_t> bytecode,
+    std::deque<llvh::SmallVector<char16_t, 5>> orderedGroupNames,
+    regex::ParsedGroupNamesMapping groupNamesMapping) {
+  if (pattern.size() > kMaxPatternLength)
+    return;
+  llvh::ArrayRef<char16_t> key = makeKey(pattern, flags);
+  if (map_.count(key))
+    return;
+
+  if (map_.size() == kCapacity) {
+    Entry *evicted = lru_.leastRecent();
+    map_.erase(evicted->key);
+    // Release the memory of the entry now, the LRU only reuses its node.
+    *evicted = Entry{};
+    lru_.remove(evicted);
+  }
+
+  Entry *entry = lru_.add(Entry{});
+  entry->key.assign(key.begin(), key.end());
+  entry->bytecode = std::move(bytecode);
+  entry->orderedGroupNames = std::move(orderedGroupNames);
+  entry->groupNamesMapping = std::move(groupNamesMapping);
+  map_[entry->key] = entry;
+}
+
+size_t RegExpCache::getMallocSizeEstimate() const {
+  size_t size = map_.getMemorySize();
+  for (const auto &it : map_) {
+    const Entry *entry = it.second;
+    size += sizeof(Entry) + entry->key.capacity() * sizeof(char16_t) +
+        entry->bytecode.capacity();
+  }
+  return size;
+}
+
+} // namespace vm
+} // namespace hermes
@@ -34,6 +34,7 @@
 #include "hermes/VM/JSLib.h"
 #include "hermes/VM/JSLib/JSLibStorage.h"
 #include "hermes/VM/JSMapImpl.h"
+#include "hermes/VM/JSPromise.h"
 #include "hermes/VM/JSProxy.h"
 #include "hermes/VM/Operations.h"
 #include "hermes/VM/PredefinedStringIDs.h"
@@ -118,7 +119,9 @@ class Runtime::StackRuntime {
   StackRuntime(const vm::RuntimeConfig &runtimeConfig)
       : thread_(runtimeMemoryThread, this) {
     startup_.get_future().get();
-    new (runtime_) Runtime(StorageProvider::mmapProvider(), runtimeConfig);
+    new (runtime_) Runtime(
+        StorageProvider::mmapProvider(runtimeConfig.getGCConfig()),
+        runtimeConfig);
   }
 
   ~StackRuntime() {
@@ -164,7 +167,8 @@ std::shared_ptr<Runtime> Runtime::create(const RuntimeConfig &runtimeConfig) {
   uint64_t providerSize = std::min<uint64_t>(
       1ULL << 32, maxHeapSize + FixedSizeHeapSegment::storageSize() * 4);
   std::shared_ptr<StorageProvider> sp =
-      StorageProvider::contiguousVAProvider(providerSize);
+      StorageProvider::contiguousVAProvider(
+          providerSize, runtimeConfig.getGCConfig());
   auto rt = HeapRuntime<Runtime>::create(sp);
   new (rt.get()) Runtime(std::move(sp), runtimeConfig);
   return rt;
@@ -172,7 +176,9 @@ std::shared_ptr<Runtime> Runtime::create(const RuntimeConfig &runtimeConfig) {
   return StackRuntime::create(runtimeConfig);
 #else
   return std::shared_ptr<Runtime>{
-      new Runtime(StorageProvider::mmapProvider(), runtimeConfig)};
+      new Runtime(
+          StorageProvider::mmapProvider(runtimeConfig.getGCConfig()),
+          runtimeConfig)};
 #endif
 }
 
@@ -542,6 +548,7 @@ Runtime::~Runtime() {
   // has any references to this.
   if (timeLimitMonitor) {
     timeLimitMonitor->unwatchRuntime(*this);
+    timeLimitMonitor->unwatchRuntimeTimeSlice(*this);
   }
 
   crashMgr_->unregisterMemory(this);
@@ -682,8 +689,11 @@ void Runtime::markRoots(RootAcceptorWithNames &acceptor, bool markLongLived) {
   {
     MarkRootsPhaseTimer timer(*this, RootAcceptor::Section::Jobs);
     acceptor.beginRootSection(RootAcceptor::Section::Jobs);
-    for (Callable *&f : jobQueue_)
-      acceptor.acceptPtr(f);
+    for (Job &job : jobQueue_) {
+      acceptor.accept(job.callee);
+      acceptor.accept(job.argument);
+      acceptor.accept(job.target);
+    }
     acceptor.endRootSection();
   }
 
@@ -1045,9 +1055,10 @@ size_t Runtime::mallocSize() const {
       shSize += sh_unit_additional_memory_size(unit);
 
   // Register stack uses mmap and RuntimeModules are tracked by their owning
-  // Domains. So this only considers IdentifierTable size.
+  // Domains. So this only considers IdentifierTable and RegExpCache size.
   return shSize + sizeof(IdentifierTable) +
-      identifierTable_.additionalMemorySize();
+      identifierTable_.additionalMemorySize() +
+      regExpCache_.getMallocSizeEstimate();
 }
 
 #if HERMESVM_SANITIZE_HANDLES != 0
@@ -1884,6 +1895,10 @@ void Runtime::initJSBuiltins(Handle<JSObject> jsBuiltinsObj) {
     auto symID = jsBuiltin.symID;
     auto builtinIndex = jsBuiltin.builtinIndex;
 
+    // Skip the builtins which already have a native implementation.
+    if (builtins_[builtinIndex])
+      continue;
+
     // Try to get the JS function from jsBuiltinsObj.
     auto getRes = JSObject::getNamed_RJS(
         jsBuiltinsObj, *this, Predefined::getSymbolID((Predefined::Str)symID));
@@ -2005,21 +2020,34 @@ void Runtime::freezeBuiltins() {
 
 ExecutionStatus Runtime::drainJobs() {
   GCScope gcScope{*this};
-  MutableHandle<Callable> job{*this};
+  MutableHandle<> callee{*this};
+  MutableHandle<> argument{*this};
+  MutableHandle<> target{*this};
   // Note that new jobs can be enqueued during the draining.
   while (!jobQueue_.empty()) {
     GCScopeMarkerRAII marker{gcScope};
 
-    job = jobQueue_.front();
+    Job::Kind kind = jobQueue_.front().kind;
+    callee = jobQueue_.front().callee;
+    argument = jobQueue_.front().argument;
+    target = jobQueue_.front().target;
     jobQueue_.pop_front();
 
-    // Jobs are guaranteed to behave as thunks.
-    auto callRes =
-        Callable::executeCall0(job, *this, Runtime::getUndefinedValue());
+    ExecutionStatus status;
+    if (LLVM_LIKELY(kind == Job::Kind::Call)) {
+      // Jobs are guaranteed to behave as thunks.
+      status = Callable::executeCall0(
+                   Handle<Callable>::vmcast(callee),
+                   *this,
+                   Runtime::getUndefinedValue())
+                   .getStatus();
+    } else {
+      status = JSPromise::runJob(*this, kind, callee, argument, target);
+    }
 
     // Early return to signal the caller. Note that the exceptional job has been
     // popped, so re-invocation would pick up from the next available job.
-    if (LLVM_UNLIKELY(callRes == ExecutionStatus::EXCEPTION)) {
+    if (LLVM_UNLIKELY(status == ExecutionStatus::EXCEPTION)) {
       return ExecutionStatus::EXCEPTION;
     }
   }
@@ -2355,6 +2383,14 @@ ExecutionStatus Runtime::notifyTimeout() {
   return raiseTimeoutError();
 }
 
+ExecutionStatus Runtime::notifyYield() {
+  if (!yieldCallback_)
+    return ExecutionStatus::RETURNED;
+  // The callback may replace itself, so call a copy.
+  auto callback = yieldCallback_;
+  return callback();
+}
+
 #ifdef HERMES_MEMORY_INSTRUMENTATION
 
 std::pair<const CodeBlock *, const inst::Inst *>
@@ -28,6 +28,9 @@ vm::RuntimeConfig buildRuntimeConfig(const RuntimeFlags &flags) {
               .withShouldReleaseUnused(vm::kReleaseUnusedOld)
               .withAllocInYoung(flags.GCAllocYoung)
               .withRevertToYGAtTTI(flags.GCRevertToYGAtTTI)
+              .withAllowHugePages(flags.GCHugePages)
+              .withPrefaultSegments(flags.GCPrefaultSegments)
+              .withRetainedFreeSegments(flags.GCRetainedFreeSegments)
               .build())
       .withMaxNumRegisters(flags.MaxNumRegisters)
       .withEnableEval(flags.EnableEval)
@@ -18,9 +18,11 @@
 #include "llvh/Support/MathExtras.h"
 
 #include <cassert>
+#include <cstring>
 #include <limits>
 #include <random>
 #include <stack>
+#include <vector>
 
 namespace hermes {
 namespace vm {
@@ -42,14 +44,30 @@ char *alignAlloc(void *p) {
 
 class VMAllocateStorageProvider final : public StorageProvider {
  public:
+  VMAllocateStorageProvider(const GCConfig &gcConfig)
+      : StorageProvider(gcConfig),
+        maxRetained_(gcConfig.getRetainedFreeSegments()) {}
+  ~VMAllocateStorageProvider() override;
+
   llvh::ErrorOr<void *> newStorageImpl(size_t sz, const char *name) override;
   void deleteStorageImpl(void *storage, size_t sz) override;
+
+ private:
+  static constexpr const char *kRetainedRegionName = "hermes-retained-heap";
+
+  /// The maximum number of storages to keep in \c retained_.
+  const size_t maxRetained_;
+  /// Deleted storages of kSegmentUnitSize bytes that are still mapped, and
+  /// will be handed out by the next requests of that size. Their pages stay
+  /// resident, so reusing them avoids both the mmap and the page faults.
+  std::vector<void *> retained_;
 };
 
 class ContiguousVAStorageProvider final : public StorageProvider {
  public:
-  ContiguousVAStorageProvider(size_t size)
-      : size_(llvh::alignTo<kSegmentUnitSize>(size)),
+  ContiguousVAStorageProvider(size_t size, const GCConfig &gcConfig)
+      : StorageProvider(gcConfig),
+        size_(llvh::alignTo<kSegmentUnitSize>(size)),
         statusBits_(size_ / kSegmentUnitSize + 1) {
     auto result = oscompat::vm_reserve_aligned(size_, kSegmentUnitSize);
     if (!result)
@@ -97,6 +115,7 @@ class ContiguousVAStorageProvider final : public StorageProvider {
 
     auto res = oscompat::vm_commit(storage, sz);
     if (res) {
+      prepareStorage(storage, sz);
       oscompat::vm_name(storage, sz, name);
     }
     return res;
@@ -153,10 +172,24 @@ class MallocStorageProvider final : public StorageProvider {
   llvh::DenseMap<void *, void *> lowLimToAllocHandle_;
 };
 
+VMAllocateStorageProvider::~VMAllocateStorageProvider() {
+  for (void *storage : retained_)
+    oscompat::vm_free_aligned(storage, kSegmentUnitSize);
+}
+
 llvh::ErrorOr<void *> VMAllocateStorageProvider::newStorageImpl(
     size_t sz,
     const char *name) {
   assert(kSegmentUnitSize % oscompat::page_size() == 0);
+  if (sz == kSegmentUnitSize && !retained_.empty()) {
+    void *mem = retained_.back();
+    retained_.pop_back();
+    // Callers expect storage to be zero-filled, as freshly mapped memory is.
+    std::memset(mem, 0, sz);
+    oscompat::vm_name(mem, sz, name);
+    noteReusedStorage();
+    return mem;
+  }
   // Allocate the space, hoping it will be the correct alignment.
   auto result = oscompat::vm_allocate_aligned(sz, kSegmentUnitSize);
   if (!result) {
@@ -165,9 +198,7 @@ llvh::ErrorOr<void *> VMAllocateStorageProvider::newStorageImpl(
   void *mem = *result;
   assert(isAligned(mem));
   (void)&isAligned;
-#ifdef HERMESVM_ALLOW_HUGE_PAGES
-  oscompat::vm_hugepage(mem, sz);
-#endif
+  prepareStorage(mem, sz);
   // Name the memory region on platforms that support naming.
   oscompat::vm_name(mem, sz, name);
   return mem;
@@ -177,6 +208,11 @@ void VMAllocateStorageProvider::deleteStorageImpl(void *storage, size_t sz) {
   if (!storage) {
     return;
   }
+  if (sz == kSegmentUnitSize && retained_.size() < maxRetained_) {
+    oscompat::vm_name(storage, sz, kRetainedRegionName);
+    retained_.push_back(storage);
+    return;
+  }
   oscompat::vm_free_aligned(storage, sz);
 }
 
@@ -206,19 +242,30 @@ void MallocStorageProvider::deleteStorageImpl(void *storage, size_t sz) {
 
 } // namespace
 
+StorageProvider::StorageProvider(const GCConfig &gcConfig)
+    : hugePages_(gcConfig.getAllowHugePages()),
+      prefault_(gcConfig.getPrefaultSegments()) {
+#ifdef HERMESVM_ALLOW_HUGE_PAGES
+  hugePages_ = true;
+#endif
+}
+
 StorageProvider::~StorageProvider() {
   assert(numLiveAllocs() == 0);
 }
 
 /* static */
-std::unique_ptr<StorageProvider> StorageProvider::mmapProvider() {
-  return std::unique_ptr<StorageProvider>(new VMAllocateStorageProvider);
+std::unique_ptr<StorageProvider> StorageProvider::mmapProvider(
+    const GCConfig &gcConfig) {
+  return std::unique_ptr<StorageProvider>(
+      new VMAllocateStorageProvider(gcConfig));
 }
 
 /* static */
 std::unique_ptr<StorageProvider> StorageProvider::contiguousVAProvider(
-    size_t size) {
-  return std::make_unique<ContiguousVAStorageProvider>(size);
+    size_t size,
+    const GCConfig &gcConfig) {
+  return std::make_unique<ContiguousVAStorageProvider>(size, gcConfig);
 }
 
 /* static */
@@ -241,6 +288,32 @@ llvh::ErrorOr<void *> StorageProvider::newStorage(size_t sz, const char *name) {
   return res;
 }
 
+void StorageProvider::prepareStorage(void *storage, size_t sz) {
+  if (hugePages_) {
+    // Must come before pre-faulting, so that the faults are served with huge
+    // pages.
+    oscompat::vm_hugepage(storage, sz);
+    numHugePageAllocs_++;
+  }
+  if (prefault_) {
+    int64_t minorBefore = 0, majorBefore = 0;
+    int64_t minorAfter = 0, majorAfter = 0;
+    bool counted =
+        oscompat::thread_page_fault_count(&minorBefore, &majorBefore);
+    oscompat::vm_populate(storage, sz);
+    if (counted &&
+        oscompat::thread_page_fault_count(&minorAfter, &majorAfter)) {
+      numPrefaultPageFaults_ +=
+          (minorAfter - minorBefore) + (majorAfter - majorBefore);
+    }
+    numPrefaultedAllocs_++;
+  }
+}
+
+void StorageProvider::noteReusedStorage() {
+  numReusedAllocs_++;
+}
+
 void StorageProvider::deleteStorage(void *storage, size_t sz) {
   if (!storage) {
     return;
@@ -301,5 +374,21 @@ size_t StorageProvider::numLiveAllocs() const {
   return numSucceededAllocs_ - numDeletedAllocs_;
 }
 
+size_t StorageProvider::numHugePageAllocs() const {
+  return numHugePageAllocs_;
+}
+
+size_t StorageProvider::numPrefaultedAllocs() const {
+  return numPrefaultedAllocs_;
+}
+
+int64_t StorageProvider::numPrefaultPageFaults() const {
+  return numPrefaultPageFaults_;
+}
+
+size_t StorageProvider::numReusedAllocs() const {
+  return numReusedAllocs_;
+}
+
 } // namespace vm
 } // namespace hermes
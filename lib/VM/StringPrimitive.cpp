@@ -196,6 +196,23 @@ CallResult<HermesValue> StringPrimitive::createEfficient(
       runtime, llvh::makeArrayRef(str.data(), str.size()), &str);
 }
 
+CallResult<HermesValue> StringPrimitive::createBorrowed(
+    Runtime &runtime,
+    ASCIIRef str,
+    std::shared_ptr<void> context) {
+  assert(isAllASCII(str.begin(), str.end()) && "8 bit strings must be ASCII");
+  return ExternalStringPrimitive<char>::createBorrowed(
+      runtime, str, std::move(context));
+}
+
+CallResult<HermesValue> StringPrimitive::createBorrowed(
+    Runtime &runtime,
+    UTF16Ref str,
+    std::shared_ptr<void> context) {
+  return ExternalStringPrimitive<char16_t>::createBorrowed(
+      runtime, str, std::move(context));
+}
+
 CallResult<HermesValue> StringPrimitive::createDynamic(
     Runtime &runtime,
     UTF16Ref str) {
@@ -458,14 +475,32 @@ template class DynamicStringPrimitive<char, false /* not Uniqued */>;
 template <typename T>
 template <class BasicString>
 ExternalStringPrimitive<T>::ExternalStringPrimitive(BasicString &&contents)
-    : SymbolStringPrimitive(contents.size()),
-      contents_(std::forward<BasicString>(contents)) {
+    : SymbolStringPrimitive(contents.size()), borrowed_(false) {
   static_assert(
       std::is_same<T, typename BasicString::value_type>::value,
       "ExternalStringPrimitive mismatched char type");
   assert(
       getStringLength() >= EXTERNAL_STRING_MIN_SIZE &&
       "ExternalStringPrimitive length must be at least EXTERNAL_STRING_MIN_SIZE");
+  new (&contents_) CopyableStdString(std::forward<BasicString>(contents));
+}
+
+template <typename T>
+ExternalStringPrimitive<T>::ExternalStringPrimitive(
+    Ref str,
+    std::shared_ptr<void> &&context)
+    : SymbolStringPrimitive(str.size()), borrowed_(true) {
+  // Borrowed strings have no length restriction, since they don't contain an
+  // std::basic_string that could use a small string optimization.
+  new (&borrowedStorage_) BorrowedStorage{str.data(), std::move(context)};
+}
+
+template <typename T>
+ExternalStringPrimitive<T>::~ExternalStringPrimitive() {
+  if (borrowed_)
+    borrowedStorage_.~BorrowedStorage();
+  else
+    contents_.~CopyableStdString();
 }
 
 // NOTE: this is a template method in a template class, thus the two separate
@@ -529,12 +564,27 @@ CallResult<HermesValue> ExternalStringPrimitive<T>::create(
   return create(runtime, StdString(length, T(0)));
 }
 
+template <typename T>
+CallResult<HermesValue> ExternalStringPrimitive<T>::createBorrowed(
+    Runtime &runtime,
+    Ref str,
+    std::shared_ptr<void> &&context) {
+  if (LLVM_UNLIKELY(str.size() > MAX_STRING_LENGTH))
+    return runtime.raiseRangeError("String length exceeds limit");
+  // The characters are not owned by the string, so there is no external
+  // memory to credit.
+  auto *extStr =
+      runtime.makeAVariable<ExternalStringPrimitive<T>, HasFinalizer::Yes>(
+          sizeof(ExternalStringPrimitive<T>), str, std::move(context));
+  return HermesValue::encodeStringValue(extStr);
+}
+
 template <typename T>
 void ExternalStringPrimitive<T>::_finalizeImpl(GCCell *cell, GC &gc) {
   ExternalStringPrimitive<T> *self = vmcast<ExternalStringPrimitive<T>>(cell);
   // Remove the external string from the snapshot tracking system if it's being
   // tracked.
-  gc.getIDTracker().untrackNative(self->contents_.data());
+  gc.getIDTracker().untrackNative(self->getRawPointer());
   gc.debitExternalMemory(self, self->calcExternalMemorySize());
   self->~ExternalStringPrimitive<T>();
 }
@@ -555,7 +605,7 @@ void ExternalStringPrimitive<T>::_snapshotAddEdgesImpl(
   snap.addNamedEdge(
       HeapSnapshot::EdgeType::Internal,
       "externalString",
-      gc.getNativeID(self->contents_.data()));
+      gc.getNativeID(self->getRawPointer()));
 }
 
 template <typename T>
@@ -568,8 +618,8 @@ void ExternalStringPrimitive<T>::_snapshotAddNodesImpl(
   snap.endNode(
       HeapSnapshot::NodeType::Native,
       "ExternalStringPrimitive",
-      gc.getNativeID(self->contents_.data()),
-      self->contents_.size(),
+      gc.getNativeID(self->getRawPointer()),
+      self->getStringLength(),
       0);
 }
 #endif
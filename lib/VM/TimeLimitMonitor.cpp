@@ -90,6 +90,26 @@ void TimeLimitMonitor::unwatchRuntime(Runtime &runtime) {
   // figure out no runtimes timed out, and sleep again.
 }
 
+void TimeLimitMonitor::watchRuntimeTimeSlice(
+    Runtime &runtime,
+    std::chrono::milliseconds slice) {
+  assert(slice.count() > 0 && "Time slices must not be empty");
+  {
+    std::lock_guard<std::mutex> lockGuard(lock_);
+    timeSlicedRuntimes_[&runtime] =
+        TimeSlice{slice, std::chrono::steady_clock::now() + slice};
+  }
+
+  // Notify the timer loop so it updates the wait timeout, as with
+  // watchRuntime().
+  timerLoopCond_.notify_all();
+}
+
+void TimeLimitMonitor::unwatchRuntimeTimeSlice(Runtime &runtime) {
+  std::lock_guard<std::mutex> lockGuard(lock_);
+  timeSlicedRuntimes_.erase(&runtime);
+}
+
 void TimeLimitMonitor::timerLoop() {
   oscompat::set_thread_name("time-limit-monitor");
 
@@ -122,6 +142,18 @@ void TimeLimitMonitor::timerLoop() {
       }
     }
 
+    for (auto &entry : timeSlicedRuntimes_) {
+      TimeSlice &timeSlice = entry.second;
+      if (timeSlice.end <= now) {
+        // The slice has elapsed; ask the VM to yield, and start the next one.
+        // Slices are measured in wall time, so a runtime which is not running
+        // JS when its slice ends yields at the next AsyncBreakCheck.
+        entry.first->triggerYieldAsyncBreak();
+        timeSlice.end = now + timeSlice.slice;
+      }
+      nextDeadline = std::min(nextDeadline, timeSlice.end);
+    }
+
     if (nextDeadline != NoDeadline) {
       // Sleep until the next deadline is reached, or the notification comes in
       // (e.g., time limit monitoring has been disabled and the thread needs to
@@ -1451,6 +1451,13 @@ void HadesGC::printStats(JSONEmitter &json) {
       oldGen_.allocatedLargeObjectBytes());
   json.emitKeyValue("Num young gen collections", numYoungCollections_);
   json.emitKeyValue("Num old gen collections", numOldCollections_);
+  json.emitKeyValue("Num huge page segments", provider_->numHugePageAllocs());
+  json.emitKeyValue(
+      "Num prefaulted segments", provider_->numPrefaultedAllocs());
+  json.emitKeyValue(
+      "Page faults taken when prefaulting",
+      provider_->numPrefaultPageFaults());
+  json.emitKeyValue("Num reused segments", provider_->numReusedAllocs());
   json.closeDict();
   json.closeDict();
 }
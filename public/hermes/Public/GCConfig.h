@@ -185,6 +185,18 @@ enum class GCEventKind {
   /* Whether to use mprotect on GC metadata between GCs. */              \
   F(constexpr, bool, ProtectMetadata, false)                             \
                                                                          \
+  /* Whether to back heap segments with huge pages where the OS */       \
+  /* supports them (transparent huge pages on Linux). */                 \
+  F(constexpr, bool, AllowHugePages, false)                              \
+                                                                         \
+  /* Whether to fault in all pages of a heap segment when it is */       \
+  /* allocated, rather than on first touch by the mutator or the GC. */  \
+  F(constexpr, bool, PrefaultSegments, false)                            \
+                                                                         \
+  /* Number of freed heap segments to keep mapped for reuse instead */   \
+  /* of returning them to the OS. Retained segments stay resident. */    \
+  F(constexpr, unsigned, RetainedFreeSegments, 0)                        \
+                                                                         \
   /* Callout for an analytics event. */                                  \
   F(HERMES_NON_CONSTEXPR,                                                \
     std::function<void(const GCAnalyticsEvent &)>,                       \
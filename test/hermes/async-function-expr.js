@@ -35,12 +35,6 @@ function task(v) {
 })().then(v => print(v));
 // CHECK-NEXT: 1
 
-(async function adopted() {
-  var x = Promise.resolve(1)
-  return x;
-})().then(v => print(v));
-// CHECK-NEXT: 1
-
 (async function tryCatch() {
   try {
     throw 0;
@@ -76,6 +70,13 @@ function task(v) {
 })([2]).then(v => print(v));
 // CHECK-NEXT: 2
 
+// Adopting the returned promise takes two more ticks.
+(async function adopted() {
+  var x = Promise.resolve(1)
+  return x;
+})().then(v => print(v));
+// CHECK-NEXT: 1
+
 
 // --- Three ticks --- //
 // print inside async function body goes into thc 3rd tick,
@@ -0,0 +1,71 @@
+/**
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+// RUN: %hermes -Xmicrotask-queue %s | %FileCheck --match-full-lines %s
+// RUN: %hermes -Xmicrotask-queue -O -gc-sanitize-handles=1 %s | %FileCheck --match-full-lines %s
+
+// Async functions driven by the native spawnAsync.
+
+print('async-function-native');
+// CHECK-LABEL: async-function-native
+
+async function params(a = (() => { throw new Error('param'); })()) {}
+params().catch(e => print('params', e.message));
+
+async function awaitThenable() {
+  return await {then: r => r('thenable')};
+}
+awaitThenable().then(v => print('awaitThenable', v));
+
+async function awaitRejection() {
+  try {
+    await Promise.reject('no');
+  } catch (e) {
+    return 'caught ' + e;
+  }
+}
+awaitRejection().then(v => print('awaitRejection', v));
+
+async function badThen() {
+  var bad = {};
+  Object.defineProperty(bad, 'then', {
+    get() {
+      throw 'then getter';
+    },
+  });
+  try {
+    await bad;
+  } catch (e) {
+    return e;
+  }
+}
+badThen().then(v => print('badThen', v));
+
+async function loop(n) {
+  var sum = 0;
+  for (var i = 0; i < n; ++i) sum += await i;
+  return sum;
+}
+loop(100).then(v => print('loop', v));
+
+var o = {
+  x: 'this',
+  async m(...args) {
+    await null;
+    return this.x + args.length;
+  },
+};
+o.m(1, 2).then(v => print('method', v));
+print('sync');
+
+// CHECK-NEXT: sync
+// CHECK-NEXT: params param
+// CHECK-NEXT: awaitRejection caught no
+// CHECK-NEXT: badThen then getter
+// CHECK-NEXT: method this2
+// CHECK-NEXT: awaitThenable thenable
+// CHECK-NEXT: loop 4950
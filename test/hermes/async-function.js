@@ -143,8 +143,6 @@ empty().then(v => print(v, "empty"));
 // CHECK-NEXT: undefined empty
 simpleReturn().then(v => print(v, "simpleReturn"));
 // CHECK-NEXT: 1 simpleReturn
-adopted().then(v => print(v, "adopted"));
-// CHECK-NEXT: 1 adopted
 tryCatch().catch(e => print(e, "tryCatch"));
 // CHECK-NEXT: 1 tryCatch
 simpleThrow().catch(e => print(e, "simpleThrow"));
@@ -165,6 +163,10 @@ nonSimpleObjDestructuring({x:2}).then(v => print(v, "nonSimpleObjDestructuring")
 restParam(0, 1, 2).then(v => print(v, "restParam"));
 // CHECK-NEXT: 2 restParam
 
+// Adopting the returned promise takes two more ticks.
+adopted().then(v => print(v, "adopted"));
+// CHECK-NEXT: 1 adopted
+
 // --- Three ticks --- //
 // print inside async function body goes into thc 3rd tick,
 // print inside `then`/`catch` callback goes into the 4th tick.
@@ -0,0 +1,58 @@
+/**
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+// RUN: %hermes -O %s | %FileCheck --match-full-lines %s
+
+// Operands large enough to use the Karatsuba multiplication, the
+// Burnikel-Ziegler division and the divide-and-conquer toString.
+
+print('BigInt large operands');
+// CHECK-LABEL: BigInt large operands
+
+function factorial(n) {
+  let r = 1n;
+  for (let i = 2n; i <= n; i++) r *= i;
+  return r;
+}
+
+let f = factorial(3000n);
+let s = f.toString();
+print(s.length, s.slice(0, 30), s.slice(4000, 4030));
+// CHECK-NEXT: 9131 414935960343785408555686709308 551279536497121487222219372928
+print(f.toString(16).slice(0, 40));
+// CHECK-NEXT: 98e50e08013d7ca50f2e2752c7698012ceaee8fc
+print(f.toString(7).length, f.toString(2).length);
+// CHECK-NEXT: 10805 30332
+print(f.toString(36).slice(0, 30));
+// CHECK-NEXT: m9c22j336h0xl43hf3h6rwrvohu0tt
+print(BigInt(s) === f, BigInt('0x' + f.toString(16)) === f);
+// CHECK-NEXT: true true
+
+let a = 3n ** 20000n + 12345n;
+let b = 7n ** 9000n + 99n;
+let q = a / b;
+let r = a % b;
+print(q * b + r === a, r < b, (a * b) / b === a, (a * b) % a === 0n);
+// CHECK-NEXT: true true true true
+print(q.toString().slice(0, 30), r.toString().slice(-30));
+// CHECK-NEXT: 348926749687062120640317469650 271715904250469182179510079146
+print((-a / b).toString().slice(0, 20), (-a % b).toString().slice(0, 20));
+// CHECK-NEXT: -3489267496870621206 -1155564948985406408
+
+let x = (1n << 30000n) - 1n;
+let y = (1n << 17000n) + (1n << 1000n) + 1n;
+print((x * y).toString().slice(0, 40), (x * y) % 1000000007n);
+// CHECK-NEXT: 2569189906325953124981283859679196675317 39570447
+print((x / y).toString().length, (x % y).toString().slice(0, 30));
+// CHECK-NEXT: 3914 323538738398684643363234502034
+print(((1n << 2700n) + 12345n) % 1000000007n);
+// CHECK-NEXT: 967387520
+
+print((10n ** 9000n).toString().length);
+// CHECK-NEXT: 9001
+print((10n ** 9000n - 1n).toString() === '9'.repeat(9000));
+// CHECK-NEXT: true
@@ -0,0 +1,203 @@
+/**
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+// RUN: %hermes -O %s | %FileCheck --match-full-lines %s
+// RUN: %hermes -O -gc-sanitize-handles=1 %s | %FileCheck --match-full-lines %s
+
+print('iterator-helpers');
+// CHECK-LABEL: iterator-helpers
+
+// An iterator over 0..n-1 logging its next and return calls.
+function counter(n, log) {
+  var i = 0;
+  return {
+    __proto__: Iterator.prototype,
+    next() {
+      log.push('next');
+      return i < n ? {value: i++, done: false} : {value: undefined, done: true};
+    },
+    return() {
+      log.push('return');
+      return {};
+    },
+  };
+}
+
+print(typeof Iterator, Iterator.length, Iterator.prototype.map.length);
+// CHECK-NEXT: function 0 1
+print(Object.prototype.toString.call([].values().map(x => x)));
+// CHECK-NEXT: [object Iterator Helper]
+print(Iterator.prototype[Symbol.toStringTag], Iterator.prototype.constructor === Iterator);
+// CHECK-NEXT: Iterator true
+
+print([1, 2, 3, 4, 5].values().map((x, i) => x * 10 + i).toArray());
+// CHECK-NEXT: 10,21,32,43,54
+print([1, 2, 3, 4, 5].values().filter(x => x % 2).toArray());
+// CHECK-NEXT: 1,3,5
+print([1, 2, 3, 4, 5].values().drop(2).take(2).toArray());
+// CHECK-NEXT: 3,4
+print([[1, 2], [], 'ab', [3]].values().flatMap(x => typeof x === 'string' ? [x] : x).toArray());
+// CHECK-NEXT: 1,2,ab,3
+print([1, 2, 3].values().reduce((a, x) => a + x));
+// CHECK-NEXT: 6
+print([1, 2, 3].values().reduce((a, x, i) => a + x * i, 100));
+// CHECK-NEXT: 108
+print([1, 2, 3].values().some(x => x > 2), [1, 2, 3].values().every(x => x > 2));
+// CHECK-NEXT: true false
+print([1, 2, 3].values().find(x => x > 1));
+// CHECK-NEXT: 2
+var seen = [];
+[1, 2, 3].values().forEach((x, i) => seen.push(x + ':' + i));
+print(seen);
+// CHECK-NEXT: 1:0,2:1,3:2
+
+// Chained helpers are lazy.
+var log = [];
+var it = counter(10, log).map(x => x * 2).filter(x => x > 2).take(2);
+print(log.length);
+// CHECK-NEXT: 0
+print(it.next().value, it.next().value, it.next().done);
+// CHECK-NEXT: 4 6 true
+print(log);
+// CHECK-NEXT: next,next,next,next,return
+
+// return() closes the underlying iterator.
+log = [];
+it = counter(10, log).map(x => x);
+print(JSON.stringify(it.return()), log);
+// CHECK-NEXT: {"done":true} return
+print(it.next().done, log);
+// CHECK-NEXT: true return
+log = [];
+it = counter(10, log).map(x => x);
+it.next();
+it.return();
+it.return();
+print(log);
+// CHECK-NEXT: next,return
+
+// Errors from the callback close the underlying iterator.
+log = [];
+try {
+  counter(10, log).map(() => { throw new Error('boom'); }).next();
+} catch (e) {
+  print(e.message, log);
+}
+// CHECK-NEXT: boom next,return
+
+// Argument validation closes the receiver.
+log = [];
+try {
+  counter(10, log).map(1);
+} catch (e) {
+  print(e.name, log);
+}
+// CHECK-NEXT: TypeError return
+log = [];
+try {
+  counter(10, log).take(-1);
+} catch (e) {
+  print(e.name, log);
+}
+// CHECK-NEXT: RangeError return
+try {
+  [].values().reduce((a, x) => a);
+} catch (e) {
+  print(e.name);
+}
+// CHECK-NEXT: TypeError
+
+// some and find close the iterator when they stop early.
+log = [];
+print(counter(10, log).some(x => x === 1), log);
+// CHECK-NEXT: true next,next,return
+
+// flatMap closes the inner iterator on return().
+log = [];
+var innerLog = [];
+it = counter(3, log).flatMap(x => counter(2, innerLog));
+it.next();
+it.return();
+print(log, innerLog);
+// CHECK-NEXT: next,return next,return
+try {
+  [1].values().flatMap(x => 'ab').next();
+} catch (e) {
+  print(e.name);
+}
+// CHECK-NEXT: TypeError
+
+// A running helper cannot be resumed.
+var running;
+running = [1].values().map(() => running.next());
+try {
+  running.next();
+} catch (e) {
+  print(e.name);
+}
+// CHECK-NEXT: TypeError
+
+// Iterator.from wraps iterators not inheriting from Iterator.prototype.
+var plain = {
+  i: 0,
+  next() { return {value: this.i++, done: this.i > 3}; },
+};
+var wrapped = Iterator.from(plain);
+print(wrapped !== plain, wrapped instanceof Iterator, wrapped.toArray());
+// CHECK-NEXT: true true 0,1,2
+print(JSON.stringify(Iterator.from(plain).return()));
+// CHECK-NEXT: {"done":true}
+var arrayIter = [1].values();
+print(Iterator.from(arrayIter) === arrayIter, Iterator.from('ab').toArray());
+// CHECK-NEXT: true a,b
+
+// Iterator can only be subclassed.
+try {
+  new Iterator();
+} catch (e) {
+  print(e.name);
+}
+// CHECK-NEXT: TypeError
+class Range extends Iterator {
+  constructor(n) {
+    super();
+    this.i = 0;
+    this.n = n;
+  }
+  next() {
+    return this.i < this.n ? {value: this.i++, done: false} : {value: undefined, done: true};
+  }
+}
+print(new Range(4).map(x => x * x).toArray());
+// CHECK-NEXT: 0,1,4,9
+
+// The constructor and @@toStringTag setters define own properties on
+// objects inheriting from Iterator.prototype.
+var r = new Range(0);
+r.constructor = 1;
+r[Symbol.toStringTag] = 'R';
+print(Object.getOwnPropertyNames(r).includes('constructor'), String(r), Iterator.prototype.constructor === Iterator);
+// CHECK-NEXT: true [object R] true
+try {
+  Iterator.prototype.constructor = 1;
+} catch (e) {
+  print(e.name);
+}
+// CHECK-NEXT: TypeError
+
+// Long chains of helpers over an array iterator.
+var big = [];
+for (var i = 0; i < 10000; i++) big.push(i);
+var chain = big.values();
+for (var i = 0; i < 100; i++) chain = chain.map(x => x + 1);
+print(chain.reduce((a, x) => a + x, 0));
+// CHECK-NEXT: 50995000
+
+// Modifying the array during iteration is observed.
+var arr = [1, 2, 3];
+print(arr.values().map(x => { if (x === 1) arr.push(4); return x; }).toArray());
+// CHECK-NEXT: 1,2,3,4
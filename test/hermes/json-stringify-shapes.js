@@ -0,0 +1,101 @@
+/**
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+// RUN: %hermes -O %s | %FileCheck --match-full-lines %s
+// RUN: %hermes -O -gc-sanitize-handles=1 %s | %FileCheck --match-full-lines %s
+
+// JSON.stringify caches the quoted keys of objects on their hidden class.
+// Objects sharing a class must still serialize their own values, and changes
+// to the shape during serialization must be observed.
+
+print('json-stringify-shapes');
+// CHECK-LABEL: json-stringify-shapes
+
+var rows = [];
+for (var i = 0; i < 3; i++) {
+  rows.push({id: i, name: 'n' + i, ok: i % 2 === 0});
+}
+print(JSON.stringify(rows));
+// CHECK-NEXT: [{"id":0,"name":"n0","ok":true},{"id":1,"name":"n1","ok":false},{"id":2,"name":"n2","ok":true}]
+print(JSON.stringify(rows, null, 1));
+// CHECK-NEXT: [
+// CHECK-NEXT:  {
+// CHECK-NEXT:   "id": 0,
+// CHECK-NEXT:   "name": "n0",
+// CHECK-NEXT:   "ok": true
+// CHECK-NEXT:  },
+// CHECK-NEXT:  {
+// CHECK-NEXT:   "id": 1,
+// CHECK-NEXT:   "name": "n1",
+// CHECK-NEXT:   "ok": false
+// CHECK-NEXT:  },
+// CHECK-NEXT:  {
+// CHECK-NEXT:   "id": 2,
+// CHECK-NEXT:   "name": "n2",
+// CHECK-NEXT:   "ok": true
+// CHECK-NEXT:  }
+// CHECK-NEXT: ]
+
+// Keys and values that need escaping, including non-ASCII ones.
+var odd = {'q"uote': 'a\\b', 'tab\t': '\u0001', 'café': '☃', n: 1.5e300};
+print(JSON.stringify(odd));
+print(JSON.stringify(odd));
+// CHECK-NEXT: {"q\"uote":"a\\b","tab\t":"\u0001","café":"☃","n":1.5e+300}
+// CHECK-NEXT: {"q\"uote":"a\\b","tab\t":"\u0001","café":"☃","n":1.5e+300}
+print(JSON.stringify({s: 'x'.repeat(40) + '"' + 'y'.repeat(40)}).length);
+// CHECK-NEXT: 90
+print(JSON.stringify('𐀀\ud800'));
+// CHECK-NEXT: "𐀀\ud800"
+
+// Non-enumerable and symbol keys are skipped.
+var hidden = {a: 1};
+Object.defineProperty(hidden, 'b', {value: 2, enumerable: false});
+hidden[Symbol('c')] = 3;
+print(JSON.stringify(hidden));
+// CHECK-NEXT: {"a":1}
+
+// An object of a cached class that turns into a dictionary.
+var dict = {x: 1, y: 2, z: 3};
+print(JSON.stringify(dict));
+// CHECK-NEXT: {"x":1,"y":2,"z":3}
+delete dict.y;
+print(JSON.stringify(dict));
+// CHECK-NEXT: {"x":1,"z":3}
+dict.w = 4;
+print(JSON.stringify(dict));
+// CHECK-NEXT: {"x":1,"z":3,"w":4}
+
+// A toJSON which changes the shape of the holder while it is serialized.
+var holder = {
+  a: {
+    toJSON: function () {
+      delete holder.b;
+      holder.c = 'added';
+      return 'A';
+    },
+  },
+  b: 'B',
+};
+print(JSON.stringify(holder));
+// CHECK-NEXT: {"a":"A"}
+holder = {
+  a: {
+    toJSON: function () {
+      holder.b = 'changed';
+      return 'A';
+    },
+  },
+  b: 'B',
+};
+print(JSON.stringify(holder));
+// CHECK-NEXT: {"a":"A","b":"changed"}
+
+// Undefined and function values are omitted, and the output is rolled back.
+print(JSON.stringify({u: undefined, f: function () {}, v: 'v'}));
+// CHECK-NEXT: {"v":"v"}
+print(JSON.stringify({u: undefined}));
+// CHECK-NEXT: {}
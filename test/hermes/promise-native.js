@@ -0,0 +1,292 @@
+/**
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+// RUN: %hermes -Xmicrotask-queue %s | %FileCheck --match-full-lines %s
+// RUN: %hermes -Xmicrotask-queue -O -gc-sanitize-handles=1 -target=HBC %s | %FileCheck --match-full-lines %s
+
+// The native Promise is used when the microtask queue is enabled.
+
+print('promise-native');
+// CHECK-LABEL: promise-native
+
+print(typeof Promise, Promise.length, Promise.name);
+// CHECK-NEXT: function 1 Promise
+print(Object.prototype.toString.call(Promise.resolve()));
+// CHECK-NEXT: [object Promise]
+print(
+  Promise.prototype.then.length,
+  Promise.prototype.catch.name,
+  Promise.prototype.finally.length,
+);
+// CHECK-NEXT: 2 catch 1
+try {
+  Promise(function () {});
+} catch (e) {
+  print(e.name);
+}
+// CHECK-NEXT: TypeError
+try {
+  new Promise(1);
+} catch (e) {
+  print(e.name);
+}
+// CHECK-NEXT: TypeError
+try {
+  Promise.prototype.then.call({});
+} catch (e) {
+  print(e.name);
+}
+// CHECK-NEXT: TypeError
+
+// Each test runs after the jobs of the previous one have all been run.
+var tests = [];
+function test(name, fn) {
+  tests.push(function () {
+    print(name);
+    fn();
+    return new Promise(function (resolve) {
+      setTimeout(resolve, 0);
+    });
+  });
+}
+
+test('ordering', function () {
+  Promise.resolve()
+    .then(() => print('a1'))
+    .then(() => print('a2'))
+    .then(() => print('a3'));
+  Promise.resolve()
+    .then(() => print('b1'))
+    .then(() => print('b2'))
+    .then(() => print('b3'));
+});
+// CHECK-LABEL: ordering
+// CHECK-NEXT: a1
+// CHECK-NEXT: b1
+// CHECK-NEXT: a2
+// CHECK-NEXT: b2
+// CHECK-NEXT: a3
+// CHECK-NEXT: b3
+
+test('adopt promise', function () {
+  // Resolving with a promise takes two extra jobs.
+  new Promise(r => r(Promise.resolve())).then(() => print('adopted'));
+  Promise.resolve()
+    .then(() => print('t1'))
+    .then(() => print('t2'))
+    .then(() => print('t3'));
+});
+// CHECK-LABEL: adopt promise
+// CHECK-NEXT: t1
+// CHECK-NEXT: t2
+// CHECK-NEXT: adopted
+// CHECK-NEXT: t3
+
+test('thenable', function () {
+  var thenable = {
+    then(resolve) {
+      print('then called');
+      resolve(42);
+      resolve(43);
+    },
+  };
+  Promise.resolve(thenable).then(v => print('thenable', v));
+  print('sync');
+});
+// CHECK-LABEL: thenable
+// CHECK-NEXT: sync
+// CHECK-NEXT: then called
+// CHECK-NEXT: thenable 42
+
+test('throwing then getter', function () {
+  var bad = {};
+  Object.defineProperty(bad, 'then', {
+    get() {
+      throw new Error('boom');
+    },
+  });
+  Promise.resolve(bad).catch(e => print('caught', e.message));
+});
+// CHECK-LABEL: throwing then getter
+// CHECK-NEXT: caught boom
+
+test('self resolution', function () {
+  var resolveSelf;
+  var p = new Promise(r => {
+    resolveSelf = r;
+  });
+  resolveSelf(p);
+  p.catch(e => print(e.constructor.name, e.message));
+});
+// CHECK-LABEL: self resolution
+// CHECK-NEXT: TypeError Promise cannot be resolved with itself
+
+test('already resolved', function () {
+  new Promise((resolve, reject) => {
+    resolve(1);
+    resolve(2);
+    reject(3);
+  }).then(v => print('first wins', v));
+  new Promise(resolve => {
+    resolve('ok');
+    throw new Error('ignored');
+  }).then(v => print('executor', v));
+});
+// CHECK-LABEL: already resolved
+// CHECK-NEXT: first wins 1
+// CHECK-NEXT: executor ok
+
+test('subclass', function () {
+  class MyPromise extends Promise {}
+  var mp = MyPromise.resolve(1);
+  print(mp instanceof MyPromise);
+  var derived = mp.then(v => v + 1);
+  print(derived instanceof MyPromise);
+  print(Promise.resolve(mp) === mp, MyPromise.resolve(mp) === mp);
+  derived.then(v => print('derived', v));
+});
+// CHECK-LABEL: subclass
+// CHECK-NEXT: true
+// CHECK-NEXT: true
+// CHECK-NEXT: false true
+// CHECK-NEXT: derived 2
+
+test('all', function () {
+  Promise.all([1, Promise.resolve(2), {then: r => r(3)}]).then(v =>
+    print('all', v.length, v.join(',')),
+  );
+});
+// CHECK-LABEL: all
+// CHECK-NEXT: all 3 1,2,3
+
+test('all empty', function () {
+  Promise.all([]).then(v => print('all empty', Array.isArray(v), v.length));
+});
+// CHECK-LABEL: all empty
+// CHECK-NEXT: all empty true 0
+
+test('all rejects', function () {
+  Promise.all([Promise.resolve(1), Promise.reject('no')]).catch(e =>
+    print('all rejected', e),
+  );
+});
+// CHECK-LABEL: all rejects
+// CHECK-NEXT: all rejected no
+
+test('all non-iterable', function () {
+  Promise.all(5).catch(e => print('all non-iterable', e.name));
+});
+// CHECK-LABEL: all non-iterable
+// CHECK-NEXT: all non-iterable TypeError
+
+test('allSettled', function () {
+  Promise.allSettled([1, Promise.reject('no')]).then(r =>
+    print(JSON.stringify(r)),
+  );
+});
+// CHECK-LABEL: allSettled
+// CHECK-NEXT: [{"status":"fulfilled","value":1},{"status":"rejected","reason":"no"}]
+
+test('any', function () {
+  Promise.any([Promise.reject(1), 5]).then(v => print('any', v));
+});
+// CHECK-LABEL: any
+// CHECK-NEXT: any 5
+
+test('any rejects', function () {
+  Promise.any([Promise.reject(1), Promise.reject(2)]).catch(e =>
+    print(e instanceof AggregateError, e.errors.join(','), e.message),
+  );
+});
+// CHECK-LABEL: any rejects
+// CHECK-NEXT: true 1,2 All promises were rejected
+
+test('race', function () {
+  Promise.race([new Promise(() => {}), Promise.resolve('fast')]).then(v =>
+    print('race', v),
+  );
+});
+// CHECK-LABEL: race
+// CHECK-NEXT: race fast
+
+test('iterator close', function () {
+  var closed = false;
+  var iterable = {
+    [Symbol.iterator]() {
+      return {
+        next() {
+          return {value: 1, done: false};
+        },
+        return() {
+          closed = true;
+          return {};
+        },
+      };
+    },
+  };
+  function Thrower(executor) {
+    return new Promise(executor);
+  }
+  Thrower.resolve = function () {
+    throw new Error('resolve threw');
+  };
+  Promise.all.call(Thrower, iterable).catch(e => print(e.message, closed));
+});
+// CHECK-LABEL: iterator close
+// CHECK-NEXT: resolve threw true
+
+test('finally', function () {
+  Promise.resolve(7)
+    .finally(() => print('finally ran'))
+    .then(v => print('finally passes', v));
+});
+// CHECK-LABEL: finally
+// CHECK-NEXT: finally ran
+// CHECK-NEXT: finally passes 7
+
+test('finally rethrows', function () {
+  Promise.reject('e')
+    .finally(() => {})
+    .catch(e => print('finally rethrows', e));
+});
+// CHECK-LABEL: finally rethrows
+// CHECK-NEXT: finally rethrows e
+
+test('finally throws', function () {
+  Promise.resolve(1)
+    .finally(() => {
+      throw 'override';
+    })
+    .catch(e => print('finally throws', e));
+});
+// CHECK-LABEL: finally throws
+// CHECK-NEXT: finally throws override
+
+test('rejection tracking', function () {
+  HermesInternal.enablePromiseRejectionTracker({
+    allRejections: true,
+    onUnhandled: function (id, error) {
+      print('unhandled', id, error.message);
+    },
+    onHandled: function (id, error) {
+      print('handled', id, error.message);
+    },
+  });
+  // Handled before the tracker reports it.
+  Promise.reject(new TypeError('quick')).catch(() => {});
+  var late = Promise.reject(new TypeError('late'));
+  setTimeout(() => late.catch(() => print('caught late')), 200);
+});
+// CHECK-LABEL: rejection tracking
+// CHECK-NEXT: unhandled 0 late
+// CHECK-NEXT: handled 0 late
+// CHECK-NEXT: caught late
+
+var chain = Promise.resolve();
+tests.forEach(function (t) {
+  chain = chain.then(t);
+});
@@ -0,0 +1,64 @@
+/**
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+// RUN: %hermes -O %s | %FileCheck --match-full-lines %s
+// RUN: %hermes -O -gc-sanitize-handles=1 %s | %FileCheck --match-full-lines %s
+
+// RegExp objects constructed at runtime share the bytecode of identical
+// patterns through the regexp cache.
+
+print('regexp-cache');
+// CHECK-LABEL: regexp-cache
+
+function stats() {
+  var s = HermesInternal.getInstrumentedStats();
+  return [s.js_regExpCacheHits, s.js_regExpCacheMisses];
+}
+
+var before = stats();
+var source = '(?<year>\\d{4})-(?<month>\\d{2})';
+for (var i = 0; i < 10; i++) {
+  var m = new RegExp(source).exec('on 2024-05');
+  if (m.groups.year !== '2024' || m.groups.month !== '05') {
+    throw new Error('bad match');
+  }
+}
+var after = stats();
+print(after[0] - before[0], after[1] - before[1]);
+// CHECK-NEXT: 9 1
+
+// The flags are part of the key.
+print(new RegExp('abc', 'i').test('ABC'), new RegExp('abc').test('ABC'));
+// CHECK-NEXT: true false
+print(new RegExp('abc', 'gi').flags, new RegExp('abc', 'ig').flags);
+// CHECK-NEXT: gi gi
+print(new RegExp('.', 'su').test('\n'), new RegExp('.', 'u').test('\n'));
+// CHECK-NEXT: true false
+
+// Invalid patterns are not cached and keep throwing.
+for (var i = 0; i < 2; i++) {
+  try {
+    new RegExp('(');
+  } catch (e) {
+    print(e.name);
+  }
+}
+// CHECK-NEXT: SyntaxError
+// CHECK-NEXT: SyntaxError
+
+// Evicted patterns still compile correctly.
+for (var i = 0; i < 200; i++) {
+  if (!new RegExp('^x' + i + '$').test('x' + i)) {
+    throw new Error('bad eviction');
+  }
+}
+before = stats();
+print(new RegExp('^x0$').test('x0'), new RegExp('^x199$').test('x199'));
+// CHECK-NEXT: true true
+after = stats();
+print(after[0] - before[0], after[1] - before[1]);
+// CHECK-NEXT: 1 1
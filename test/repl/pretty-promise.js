@@ -33,15 +33,16 @@ p.foo = 1; p;
 "Promise adoption"
 // CHECK-LABEL: "Promise adoption"
 
+// Adopting a promise takes a job, which runs after the result is printed.
 new Promise((res) => { res(Promise.resolve(1)) })
-// CHECK-NEXT: Promise <fulfilled: 1>
+// CHECK-NEXT: Promise <pending>
 
 new Promise((res) => {
     res(
         new Promise((res) => { res(Promise.resolve(1)) })
     )
 })
-// CHECK-NEXT: Promise <fulfilled: 1>
+// CHECK-NEXT: Promise <pending>
 
 new Promise((res, rej) => { rej(Promise.resolve(1)) })
 // CHECK-NEXT: Promise <rejected: Promise <fulfilled: 1>>
@@ -51,7 +52,7 @@ new Promise((res, rej) => {
         new Promise((res) => { res(Promise.resolve(1)) })
     )
 })
-// CHECK-NEXT: Promise <rejected: Promise <fulfilled: 1>>
+// CHECK-NEXT: Promise <rejected: Promise <pending>>
 
 
 "User-space Promise"
@@ -43,7 +43,15 @@ static llvh::cl::opt<std::string> DumpOutputFilename(
 
 static llvh::cl::opt<std::string> SourceMapFilename(
     "source-map",
-    llvh::cl::desc("Optional source-map file name, used by function-info"));
+    llvh::cl::desc(
+        "Optional source-map file name, used by function-info. "
+        "Either a JSON source map or an index written by -source-map-index"));
+
+static llvh::cl::opt<std::string> SourceMapIndexFilename(
+    "source-map-index",
+    llvh::cl::desc(
+        "Write the JSON source map given by -source-map to this file as a "
+        "binary index, which loads without parsing or decoding"));
 
 static llvh::cl::opt<std::string> StartupCommands(
     "c",
@@ -513,13 +521,35 @@ int main(int argc, char **argv) {
       return -1;
     }
     SourceErrorManager sm;
-    sourceMap = SourceMapParser::parse(*sourceMapBufOrErr.get().get(), {}, sm);
+    std::unique_ptr<llvh::MemoryBuffer> sourceMapBuf =
+        std::move(sourceMapBufOrErr.get());
+    if (SourceMapParser::isIndex(*sourceMapBuf)) {
+      // The index is used in place, without parsing or decoding anything.
+      sourceMap = SourceMapParser::loadIndex(std::move(sourceMapBuf), {}, sm);
+    } else {
+      sourceMap = SourceMapParser::parse(*sourceMapBuf, {}, sm, /* lazy */ true);
+    }
     if (!sourceMap) {
       llvh::errs() << "Error loading source map: " << SourceMapFilename << "\n";
       return -1;
     }
   }
 
+  if (!SourceMapIndexFilename.empty()) {
+    if (!sourceMap || !sourceMap->isLazy()) {
+      llvh::errs() << "Error: -source-map-index requires a JSON -source-map\n";
+      return -1;
+    }
+    std::error_code EC;
+    raw_fd_ostream indexOS(SourceMapIndexFilename, EC, llvh::sys::fs::F_None);
+    if (EC) {
+      llvh::errs() << "Error: fail to open file: " << SourceMapIndexFilename
+                   << ": " << EC.message() << '\n';
+      return -1;
+    }
+    sourceMap->writeIndex(indexOS);
+  }
+
   if (ProfileFile.empty()) {
     if (ShowSectionRanges) {
       BytecodeSectionWalker walker(bytecodeStart, std::move(ret.first), output);
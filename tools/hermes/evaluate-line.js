@@ -63,23 +63,32 @@ C_STRING((function() {
   function prettyPrintPromise(value, visited) {
     var internalColor = colors.cyan;
     var internals = "";
-    switch(value['_y']) {
+    var status = value['_y'];
+    var result = value['_z'];
+    // The native Promise exposes its state through HermesInternal instead of
+    // internal properties.
+    var state = HermesInternal.getPromiseState?.(value);
+    if (state) {
+      status = ['pending', 'fulfilled', 'rejected'].indexOf(state.status);
+      result = status === 2 ? state.reason : state.value;
+    }
+    switch(status) {
       case 0:
         internals = "<pending>";
         break;
       case 1:
         internals = "<fulfilled: " + colors.reset +
-            prettyPrintRec(value['_z'], visited) +
+            prettyPrintRec(result, visited) +
             internalColor + ">";
         break;
       case 2:
         internals = "<rejected: " + colors.reset +
-            prettyPrintRec(value['_z'], visited) +
+            prettyPrintRec(result, visited) +
             internalColor + ">";
         break;
       case 3:
         // the case of an "adopted" promise; print the adoptee promise instead.
-        return prettyPrintPromise(value['_z'], visited);
+        return prettyPrintPromise(result, visited);
       default:
         break;
     };
@@ -91,7 +91,11 @@ static int executeHBCBytecodeFromCL(
                                      .build())
                              .withShouldReleaseUnused(vm::kReleaseUnusedNone)
                              .withAllocInYoung(flags.GCAllocYoung)
-                             .withRevertToYGAtTTI(flags.GCRevertToYGAtTTI);
+                             .withRevertToYGAtTTI(flags.GCRevertToYGAtTTI)
+                             .withAllowHugePages(flags.GCHugePages)
+                             .withPrefaultSegments(flags.GCPrefaultSegments)
+                             .withRetainedFreeSegments(
+                                 flags.GCRetainedFreeSegments);
 
   std::vector<vm::GCAnalyticsEvent> gcAnalyticsEvents;
   if (flags.GCPrintStats || flags.GCBeforeStats ||
@@ -0,0 +1,34 @@
+/**
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+// Like allocObjLit.js, but allocates object literals of several shapes,
+// including ones with more properties than fit in the direct property slots.
+
+var x = null;
+
+function doAlloc() {
+    for (var i = 0; i < 100000; i++) {
+        x = {a: 1, b: 'abc', c: null};
+        x = {id: i, name: 'abc', visible: true, parent: null};
+        x = {x: 0, y: 1, width: 10, height: 20, color: 'red', border: 2};
+        x = {a: 1, b: 2, c: 3, d: 4, e: 5, f: 6, g: 7, h: 8, i: 9, j: 10};
+        x = {type: 'div', key: null, ref: null, props: x, owner: null};
+        x = {a: 1, b: 'abc', c: null};
+        x = {id: i, name: 'abc', visible: true, parent: null};
+        x = {x: 0, y: 1, width: 10, height: 20, color: 'red', border: 2};
+        x = {a: 1, b: 2, c: 3, d: 4, e: 5, f: 6, g: 7, h: 8, i: 9, j: 10};
+        x = {type: 'div', key: null, ref: null, props: x, owner: null};
+    }
+}
+
+function allocNTimes(n) {
+    for (var i = 0; i < n; i++) {
+        doAlloc()
+    }
+}
+
+print(allocNTimes(100));
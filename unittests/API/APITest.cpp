@@ -471,6 +471,68 @@ TEST(HermesWatchTimeLimitTest, WatchTimeLimit) {
   }
 }
 
+TEST(HermesTimeSlicingTest, YieldAndResume) {
+  std::shared_ptr<HermesRuntime> rt = makeHermesRuntime();
+  auto slicingRt = dynamicInterfaceCast<IHermesTimeSlicing>(rt);
+  ASSERT_TRUE(slicingRt);
+  // Another tenant, which runs while the first one is paused.
+  auto other = makeHermesRuntime();
+
+  int yields = 0;
+  slicingRt->setYieldHandler([&]() {
+    ++yields;
+    EXPECT_EQ(
+        other->evaluateJavaScript(std::make_unique<StringBuffer>("6 * 7"), "")
+            .getNumber(),
+        42);
+    if (yields < 3) {
+      slicingRt->asyncRequestYield();
+    } else {
+      rt->global().setProperty(*rt, "stop", true);
+    }
+  });
+
+  // The script resumes where it yielded, and observes the state set by the
+  // handler.
+  slicingRt->asyncRequestYield();
+  auto res = rt->evaluateJavaScript(
+      std::make_unique<StringBuffer>(
+          "var n = 0; while (!globalThis.stop) ++n; n > 0"),
+      "");
+  EXPECT_TRUE(res.getBool());
+  EXPECT_EQ(yields, 3);
+
+  // Yields are requested periodically while the time slice is watched.
+  yields = 0;
+  slicingRt->setYieldHandler([&]() { ++yields; });
+  slicingRt->watchTimeSlice(10);
+  rt->evaluateJavaScript(
+      std::make_unique<StringBuffer>(
+          "var t = Date.now(); while (Date.now() < t + 100) {}"),
+      "");
+  slicingRt->unwatchTimeSlice();
+  EXPECT_GT(yields, 0);
+
+  // Throwing from the handler cancels the script.
+  slicingRt->setYieldHandler(
+      [&]() { throw JSError(*rt, "cancelled"); });
+  slicingRt->asyncRequestYield();
+  try {
+    rt->evaluateJavaScript(std::make_unique<StringBuffer>("for (;;) {}"), "");
+    FAIL() << "Expected the script to be cancelled";
+  } catch (const JSError &e) {
+    EXPECT_EQ(e.getMessage(), "cancelled");
+  }
+
+  // Requests are ignored without a handler.
+  slicingRt->setYieldHandler(nullptr);
+  slicingRt->asyncRequestYield();
+  EXPECT_EQ(
+      rt->evaluateJavaScript(std::make_unique<StringBuffer>("1 + 1"), "")
+          .getNumber(),
+      2);
+}
+
 #if HERMESVM_GCKIND == _HERMESVM_GCVALUE_HADES
 TEST_P(HermesRuntimeTest, GetHeapInfo) {
   auto &instrumentation = rt->instrumentation();
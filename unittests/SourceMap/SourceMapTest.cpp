@@ -553,6 +553,155 @@ TEST(SourceMap, EmptyLines) {
       *sourceMap, generatedLine, sources, loc(28, sourceIndex, 2, 10));
 }
 
+/// Parse the null terminated \p json with the given \p baseDir and \p lazy.
+std::unique_ptr<SourceMap> parseMap(
+    llvh::StringRef json,
+    SourceErrorManager &sm,
+    bool lazy = false,
+    llvh::StringRef baseDir = {}) {
+  return SourceMapParser::parse(
+      llvh::MemoryBufferRef(json, "<source map>"), baseDir, sm, lazy);
+}
+
+/// Check that \p a and \p b map every column of the first \p numColumns of
+/// the first \p numLines generated lines (and one line past) identically.
+void expectSameMappings(
+    const SourceMap &a,
+    const SourceMap &b,
+    uint32_t numLines,
+    uint32_t numColumns) {
+  for (uint32_t line = 1; line <= numLines + 1; ++line) {
+    for (uint32_t column = 1; column <= numColumns; ++column) {
+      auto segA = a.getSegmentForAddress(line, column);
+      auto segB = b.getSegmentForAddress(line, column);
+      ASSERT_EQ(segA.hasValue(), segB.hasValue()) << line << ":" << column;
+      if (!segA)
+        continue;
+      EXPECT_EQ(segA->generatedColumn, segB->generatedColumn);
+      auto &locA = segA->representedLocation;
+      auto &locB = segB->representedLocation;
+      ASSERT_EQ(locA.hasValue(), locB.hasValue()) << line << ":" << column;
+      if (!locA)
+        continue;
+      EXPECT_EQ(locA->sourceIndex, locB->sourceIndex);
+      EXPECT_EQ(locA->lineIndex, locB->lineIndex);
+      EXPECT_EQ(locA->columnIndex, locB->columnIndex);
+      EXPECT_EQ(locA->nameIndex, locB->nameIndex);
+    }
+  }
+}
+
+/// \return a source map JSON with \p numLines lines of \p segmentsPerLine
+/// segments each, covering a mix of segment kinds.
+std::string generateLongLinesMap(uint32_t numLines, uint32_t segmentsPerLine) {
+  SourceMapGenerator gen;
+  gen.addSource("a.js");
+  gen.addSource("b.js");
+  for (uint32_t line = 0; line < numLines; ++line) {
+    SourceMap::SegmentList segments;
+    for (uint32_t i = 0; i < segmentsPerLine; ++i) {
+      int32_t col = i * 3;
+      if (i % 7 == 6)
+        segments.push_back(loc(col));
+      else if (i % 5 == 4)
+        segments.push_back(loc(col, i % 2, i + 1, i % 11, i % 3));
+      else
+        segments.push_back(loc(col, i % 2, i + 1, i % 11));
+    }
+    gen.addMappingsLine(segments, line);
+  }
+  std::string storage;
+  llvh::raw_string_ostream OS(storage);
+  gen.outputAsJSON(OS);
+  return OS.str();
+}
+
+TEST(SourceMap, LazyMatchesEager) {
+  SourceErrorManager sm;
+  SimpleDiagHandlerRAII diagHandler(sm);
+  for (const char *json : {TestMap, TestMapEmptyLines}) {
+    auto eager = parseMap(json, sm);
+    auto lazy = parseMap(json, sm, /* lazy */ true);
+    ASSERT_TRUE(eager && lazy);
+    EXPECT_FALSE(eager->isLazy());
+    EXPECT_TRUE(lazy->isLazy());
+    EXPECT_EQ(eager->getAllFullPathSources(), lazy->getAllFullPathSources());
+    expectSameMappings(*eager, *lazy, 4, 40);
+  }
+}
+
+TEST(SourceMap, LazyLongLines) {
+  // Lines span several blocks, and lookups cycle through more blocks than
+  // are cached.
+  std::string json = generateLongLinesMap(12, 1000);
+  SourceErrorManager sm;
+  SimpleDiagHandlerRAII diagHandler(sm);
+  auto eager = parseMap(json, sm);
+  auto lazy = parseMap(json, sm, /* lazy */ true);
+  ASSERT_TRUE(eager && lazy);
+  expectSameMappings(*eager, *lazy, 12, 3010);
+}
+
+TEST(SourceMap, LazyInvalidMappings) {
+  SourceErrorManager sm;
+  SimpleDiagHandlerRAII diagHandler(sm);
+  auto lazy = parseMap(
+      R"#({"version": 3, "sources": ["a.js"], "mappings": "AAAA,,AAAA"})#",
+      sm,
+      /* lazy */ true);
+  EXPECT_FALSE(lazy);
+  EXPECT_TRUE(diagHandler.haveErrors());
+}
+
+TEST(SourceMap, IndexRoundTrip) {
+  std::string json = generateLongLinesMap(3, 200);
+  SourceErrorManager sm;
+  SimpleDiagHandlerRAII diagHandler(sm);
+  auto eager = parseMap(json, sm, /* lazy */ false, "/base");
+  auto lazy = parseMap(json, sm, /* lazy */ true, "/base");
+  ASSERT_TRUE(eager && lazy);
+  EXPECT_FALSE(SourceMapParser::isIndex(llvh::MemoryBufferRef(json, "")));
+
+  std::string storage;
+  llvh::raw_string_ostream OS(storage);
+  EXPECT_FALSE(eager->writeIndex(OS));
+  EXPECT_TRUE(lazy->writeIndex(OS));
+  OS.flush();
+
+  auto buffer = llvh::MemoryBuffer::getMemBuffer(storage, "", false);
+  EXPECT_TRUE(SourceMapParser::isIndex(*buffer));
+  auto loaded = SourceMapParser::loadIndex(std::move(buffer), "/base", sm);
+  ASSERT_TRUE(loaded);
+  EXPECT_TRUE(loaded->isLazy());
+  EXPECT_EQ(eager->getAllFullPathSources(), loaded->getAllFullPathSources());
+  expectSameMappings(*eager, *loaded, 3, 610);
+}
+
+TEST(SourceMap, IndexCorrupt) {
+  std::string json = generateLongLinesMap(2, 100);
+  SourceErrorManager sm;
+  SimpleDiagHandlerRAII diagHandler(sm);
+  auto lazy = parseMap(json, sm, /* lazy */ true);
+  ASSERT_TRUE(lazy);
+  std::string storage;
+  llvh::raw_string_ostream OS(storage);
+  lazy->writeIndex(OS);
+  OS.flush();
+
+  // Truncated.
+  auto truncated = llvh::MemoryBuffer::getMemBufferCopy(
+      llvh::StringRef(storage).drop_back());
+  EXPECT_FALSE(SourceMapParser::loadIndex(std::move(truncated), {}, sm));
+  EXPECT_TRUE(diagHandler.haveErrors());
+
+  // A line refers past the last block.
+  std::string badLines = storage;
+  // The first line start follows the 32 byte header and two source ends.
+  badLines[32 + 8] = 100;
+  EXPECT_FALSE(SourceMapParser::loadIndex(
+      llvh::MemoryBuffer::getMemBufferCopy(badLines), {}, sm));
+}
+
 TEST(SourceMap, VLQRandos) {
   // clang-format off
   const std::vector<int32_t> inputs = {0, 1, -1, 2, -2, 5298, -23498,
@@ -0,0 +1,188 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include "hermes/Support/FastCharScan.h"
+
+#include <string>
+
+#include <gtest/gtest.h>
+
+namespace {
+
+using namespace hermes;
+
+/// \return the number of characters scanned by \p scan over \p str.
+template <typename F>
+size_t scanLength(const std::string &str, F scan) {
+  const char *begin = str.data();
+  return scan(begin, begin + str.size()) - begin;
+}
+
+//===----------------------------------------------------------------------===//
+// scanASCIIIdentifierChars
+//===----------------------------------------------------------------------===//
+
+size_t identLength(const std::string &str, char extra = '_') {
+  return scanLength(str, [extra](const char *cur, const char *end) {
+    return scanASCIIIdentifierChars(cur, end, extra);
+  });
+}
+
+TEST(FastCharScanTest, IdentifierEmpty) {
+  EXPECT_EQ(identLength(""), 0u);
+}
+
+TEST(FastCharScanTest, IdentifierWhole) {
+  EXPECT_EQ(identLength("abc"), 3u);
+  std::string all =
+      "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789_$";
+  EXPECT_EQ(identLength(all), all.size());
+}
+
+TEST(FastCharScanTest, IdentifierStopsAtEveryPosition) {
+  // Exercise both the vector loop and the scalar tail.
+  for (size_t len = 0; len < 40; ++len) {
+    std::string str(len, 'a');
+    EXPECT_EQ(identLength(str + ' ' + "abc"), len);
+    EXPECT_EQ(identLength(str + '.'), len);
+  }
+}
+
+TEST(FastCharScanTest, IdentifierNonIdentifierChars) {
+  // Characters just outside each accepted range, and the characters that map
+  // onto letters when bit 5 is set.
+  for (char ch : std::string("/:@[`{\x7f\x80\xc3\xff\0 -", 13)) {
+    std::string str = std::string(20, 'x') + ch + "xx";
+    EXPECT_EQ(identLength(str), 20u) << "char " << (int)ch;
+  }
+}
+
+TEST(FastCharScanTest, IdentifierExtra) {
+  std::string str = "data-foo-bar-baz-qux@x y";
+  EXPECT_EQ(identLength(str), 4u);
+  EXPECT_EQ(identLength(str, '-'), 20u);
+  EXPECT_EQ(identLength(str, '@'), 4u);
+  EXPECT_EQ(identLength("a@b", '@'), 3u);
+}
+
+//===----------------------------------------------------------------------===//
+// skipSpacesAndTabs
+//===----------------------------------------------------------------------===//
+
+size_t blankLength(const std::string &str) {
+  return scanLength(str, skipSpacesAndTabs);
+}
+
+TEST(FastCharScanTest, SpacesEmpty) {
+  EXPECT_EQ(blankLength(""), 0u);
+  EXPECT_EQ(blankLength("x"), 0u);
+}
+
+TEST(FastCharScanTest, SpacesStopsAtEveryPosition) {
+  for (size_t len = 0; len < 40; ++len) {
+    std::string str;
+    for (size_t i = 0; i < len; ++i)
+      str += i % 3 ? ' ' : '\t';
+    EXPECT_EQ(blankLength(str), len);
+    EXPECT_EQ(blankLength(str + "x  "), len);
+    EXPECT_EQ(blankLength(str + "\n  "), len);
+    EXPECT_EQ(blankLength(str + "\xa0  "), len);
+  }
+}
+
+//===----------------------------------------------------------------------===//
+// scanUntilSpecialChar
+//===----------------------------------------------------------------------===//
+
+size_t plainLength(const std::string &str, char stop1, char stop2) {
+  return scanLength(str, [stop1, stop2](const char *cur, const char *end) {
+    return scanUntilSpecialChar(cur, end, stop1, stop2);
+  });
+}
+
+TEST(FastCharScanTest, SpecialEmpty) {
+  EXPECT_EQ(plainLength("", '"', '\\'), 0u);
+}
+
+TEST(FastCharScanTest, SpecialNoneFound) {
+  std::string str = "The quick brown fox jumps over the lazy dog! 0123456789";
+  EXPECT_EQ(plainLength(str, '"', '\\'), str.size());
+}
+
+TEST(FastCharScanTest, SpecialStopsAtEveryPosition) {
+  for (size_t len = 0; len < 40; ++len) {
+    std::string str(len, 'a');
+    for (char ch : std::string("\"\\\n\r\0\x80\xe2\xff", 8)) {
+      EXPECT_EQ(plainLength(str + ch + "aaaa", '"', '\\'), len)
+          << "char " << (int)ch;
+    }
+    // A stop character for one scan is a plain character for another.
+    EXPECT_EQ(plainLength(str + "'", '*', '*'), len + 1);
+    EXPECT_EQ(plainLength(str + "*", '*', '*'), len);
+  }
+}
+
+//===----------------------------------------------------------------------===//
+// scanASCII
+//===----------------------------------------------------------------------===//
+
+size_t asciiLength(const std::string &str) {
+  const uint8_t *begin = reinterpret_cast<const uint8_t *>(str.data());
+  return scanASCII(begin, begin + str.size()) - begin;
+}
+
+TEST(FastCharScanTest, ASCIIEmpty) {
+  EXPECT_EQ(asciiLength(""), 0u);
+}
+
+TEST(FastCharScanTest, ASCIIWhole) {
+  std::string all;
+  for (int ch = 0; ch < 0x80; ++ch)
+    all += (char)ch;
+  EXPECT_EQ(asciiLength(all), all.size());
+}
+
+TEST(FastCharScanTest, ASCIIStopsAtEveryPosition) {
+  for (size_t len = 0; len < 40; ++len) {
+    std::string str(len, 'a');
+    for (char ch : std::string("\x80\xc3\xef\xff")) {
+      EXPECT_EQ(asciiLength(str + ch + "aaaa"), len) << "char " << (int)ch;
+    }
+  }
+}
+
+//===----------------------------------------------------------------------===//
+// scanUntilJSONEscape
+//===----------------------------------------------------------------------===//
+
+size_t jsonLength(const std::string &str) {
+  return scanLength(str, scanUntilJSONEscape);
+}
+
+TEST(FastCharScanTest, JSONEmpty) {
+  EXPECT_EQ(jsonLength(""), 0u);
+}
+
+TEST(FastCharScanTest, JSONNoneFound) {
+  std::string all;
+  for (int ch = 0x20; ch < 0x80; ++ch) {
+    if (ch != '"' && ch != '\\')
+      all += (char)ch;
+  }
+  EXPECT_EQ(jsonLength(all), all.size());
+}
+
+TEST(FastCharScanTest, JSONStopsAtEveryPosition) {
+  for (size_t len = 0; len < 40; ++len) {
+    std::string str(len, 'a');
+    for (char ch : std::string("\"\\\0\n\x1f\x80\xff", 7)) {
+      EXPECT_EQ(jsonLength(str + ch + "aaaa"), len) << "char " << (int)ch;
+    }
+  }
+}
+
+} // end anonymous namespace
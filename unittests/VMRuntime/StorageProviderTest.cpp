@@ -211,6 +211,66 @@ TEST(StorageProviderTest, StorageProviderAllocsCount) {
   EXPECT_EQ(LIM, provider->numDeletedAllocs());
 }
 
+/// Deleted storage is kept for reuse up to the configured limit, and comes
+/// back zero-filled.
+TEST(StorageProviderTest, RetainedFreeSegmentsReused) {
+  auto provider = StorageProvider::mmapProvider(
+      GCConfig::Builder().withRetainedFreeSegments(1).build());
+
+  auto result1 = provider->newStorage(SIZE);
+  ASSERT_TRUE(result1);
+  auto result2 = provider->newStorage(SIZE);
+  ASSERT_TRUE(result2);
+  char *s1 = static_cast<char *>(*result1);
+  s1[0] = 1;
+  s1[SIZE - 1] = 1;
+
+  // Only the first deleted storage is retained.
+  provider->deleteStorage(s1, SIZE);
+  provider->deleteStorage(*result2, SIZE);
+
+  auto result3 = provider->newStorage(SIZE);
+  ASSERT_TRUE(result3);
+  EXPECT_EQ(s1, *result3);
+  EXPECT_EQ(0, s1[0]);
+  EXPECT_EQ(0, s1[SIZE - 1]);
+  EXPECT_EQ(1, provider->numReusedAllocs());
+
+  auto result4 = provider->newStorage(SIZE);
+  ASSERT_TRUE(result4);
+  EXPECT_EQ(1, provider->numReusedAllocs());
+
+  provider->deleteStorage(*result3, SIZE);
+  provider->deleteStorage(*result4, SIZE);
+  EXPECT_EQ(0, provider->numLiveAllocs());
+}
+
+/// The huge page and pre-fault options are applied to every new storage.
+TEST_P(StorageProviderTest, HugePagesAndPrefault) {
+  auto &params = GetParam();
+  auto config = GCConfig::Builder()
+                    .withAllowHugePages(true)
+                    .withPrefaultSegments(true)
+                    .build();
+  auto provider = params.providerType == MmapProvider
+      ? StorageProvider::mmapProvider(config)
+      : StorageProvider::contiguousVAProvider(params.vaSize, config);
+
+  auto result = provider->newStorage(params.storageSize, "Test");
+  ASSERT_TRUE(result);
+  EXPECT_EQ(1, provider->numHugePageAllocs());
+  EXPECT_EQ(1, provider->numPrefaultedAllocs());
+  EXPECT_LE(0, provider->numPrefaultPageFaults());
+
+  // The storage must still be zero-filled and writable.
+  char *s = static_cast<char *>(*result);
+  EXPECT_EQ(0, s[0]);
+  EXPECT_EQ(0, s[params.storageSize - 1]);
+  s[params.storageSize - 1] = 1;
+
+  provider->deleteStorage(s, params.storageSize);
+}
+
 /// Testing that the ContiguousProvider allocates and deallocates as intended,
 /// which is to always allocate at lowest-address free space and correctly free
 /// the space when the storage is deleted.
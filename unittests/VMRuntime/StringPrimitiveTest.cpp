@@ -102,6 +102,40 @@ TEST_F(StringPrimTest, CreateEfficientTest) {
   }
 }
 
+TEST_F(StringPrimTest, CreateBorrowedTest) {
+  // Borrowed strings reference the characters in place, regardless of length,
+  // and release their context only when they are collected.
+  static const char narrow[] = "borrowed";
+  static const char16_t wide[] = u"borrowed\u1234";
+  auto context = std::make_shared<int>(0);
+  std::weak_ptr<int> weakContext = context;
+
+  {
+    GCScope gcScope{runtime};
+    auto s1 = runtime.makeHandle<StringPrimitive>(
+        *StringPrimitive::createBorrowed(
+            runtime, createASCIIRef(narrow), context));
+    auto s2 = runtime.makeHandle<StringPrimitive>(
+        *StringPrimitive::createBorrowed(
+            runtime, createUTF16Ref(wide), std::move(context)));
+
+    EXPECT_TRUE(s1->isExternal());
+    EXPECT_TRUE(s2->isExternal());
+    EXPECT_EQ(narrow, s1->getStringRef<char>().data());
+    EXPECT_EQ(wide, s2->getStringRef<char16_t>().data());
+    EXPECT_EQ(8u, s1->getStringLength());
+    EXPECT_EQ(9u, s2->getStringLength());
+    EXPECT_TRUE(
+        s1->equals(StringPrimitive::createNoThrow(runtime, "borrowed").get()));
+
+    runtime.collect("test");
+    EXPECT_FALSE(weakContext.expired());
+  }
+
+  runtime.collect("test");
+  EXPECT_TRUE(weakContext.expired());
+}
+
 TEST_F(StringPrimTest, CompareTest) {
 #define TEST_CMP(v, a, b)                                 \
   {                                                       \